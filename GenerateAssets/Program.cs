@@ -6,6 +6,7 @@ using System.Collections.Generic;
 using System.IO;
 using System.Linq;
 using System.Text;
+using System.Text.RegularExpressions;
 
 namespace GenerateAssets
 {
@@ -32,7 +33,7 @@ namespace GenerateAssets
                 .ParseGpcrDbStructures()
                 .GetGpcrDbPdbList();
 
-            var pdbDict = new List<(string pdb_id, string uniprot_id, string symbol_species, string symbol, string species, string lspecies, string gene_name)>();
+            var pdbDict = new List<(string pdb_id, string uniprot_id, string symbol_species, string symbol, string species, string lspecies, string gene_name, string cls)>();
             var numberingDict = new Dictionary<string, Dictionary<int, List<string>>>();
             var residueNameDict = new Dictionary<string, Dictionary<int, char>>();
             bool first = true;
@@ -52,7 +53,10 @@ namespace GenerateAssets
 
                 Logger.Current.LogInformation($"Working on {pdb.UniProtId}, {pdb.PdbEntry}, {symbol}, {species}({pdb.Species}), {pdb.Iuphar}, {geneName}");
 
-                pdbDict.Add((pdb.PdbEntry.ToUpper(), pdb.UniProtId.ToUpper(), $"{symbol}_{species}".ToUpper(), symbol.ToUpper(), species.ToUpper(), pdb.Species, geneName.ToUpper()));
+                // e.g. "Class A (Rhodopsin)" => "A", "Class B1 (Secretin)" => "B1"
+                var cls = Regex.Match(pdb.Class, @"Class\s+(\w+)");
+
+                pdbDict.Add((pdb.PdbEntry.ToUpper(), pdb.UniProtId.ToUpper(), $"{symbol}_{species}".ToUpper(), symbol.ToUpper(), species.ToUpper(), pdb.Species, geneName.ToUpper(), cls.Success ? cls.Groups[1].Value.ToUpper() : ""));
 
                 List<(string Name, string ShortName)> headers = null;
 
@@ -198,19 +202,28 @@ namespace GenerateAssets
             outCpp.AppendLine("#include \"assets.hpp\"");
             outCpp.AppendLine();
 
+            // snapshot date
+            outHpp.AppendLine("// date of the GPCRdb snapshot");
+            outHpp.AppendLine("extern string gpcrdb_version;");
+            outHpp.AppendLine();
+
+            outCpp.AppendLine("// date of the GPCRdb snapshot");
+            outCpp.AppendLine($"string gpcrdb_version = \"{DateTime.Now:yyyy-MM-dd}\";");
+            outCpp.AppendLine();
+
             // string table
             outHpp.AppendLine("// string_index => string");
-            outHpp.AppendLine($"extern array<string, {strings.Count}> string_table;");
+            outHpp.AppendLine("extern vector<string> string_table;");
             outHpp.AppendLine();
 
             outCpp.AppendLine("// string_index => string");
-            outCpp.AppendLine($"array<string, {strings.Count}> string_table =");
-            outCpp.AppendLine("{{");
+            outCpp.AppendLine("vector<string> string_table =");
+            outCpp.AppendLine("{");
             outCpp.AppendLine($"//   {string.Join("", maxWidths.Select(o => "v".PadRight(o)))}");
             foreach (var (str, index) in strings)
                 outCpp.AppendLine($"\t\"{str}\",");
             outCpp.AppendLine($"//   {string.Join("", maxWidths.Select(o => "^".PadRight(o)))}");
-            outCpp.AppendLine("}};");
+            outCpp.AppendLine("};");
             outCpp.AppendLine();
 
             // schemes
@@ -254,6 +267,19 @@ namespace GenerateAssets
             outCpp.AppendLine("};");
             outCpp.AppendLine();
 
+            // uniprot_id => class
+            outHpp.AppendLine("// uniprot_id => class");
+            outHpp.AppendLine("extern map<string, string> class_dict;");
+            outHpp.AppendLine();
+
+            outCpp.AppendLine("// uniprot_id => class");
+            outCpp.AppendLine("map<string, string> class_dict =");
+            outCpp.AppendLine("{");
+            foreach (var (uniprot_id, cls) in pdbDict.Select(o => (o.uniprot_id, o.cls)).Distinct())
+                outCpp.AppendLine($"\t{{\"{uniprot_id}\", {"".PadRight(pdbDict.Max(o => o.uniprot_id.Length) - uniprot_id.Length)}\"{cls}\"}},");
+            outCpp.AppendLine("};");
+            outCpp.AppendLine();
+
             // symbol => uniprot_id
             outHpp.AppendLine("// symbol => uniprot_id");
             outHpp.AppendLine("extern multimap<string, string> symbol_dict;");
@@ -306,22 +332,36 @@ namespace GenerateAssets
             outCpp.AppendLine("};");
             outCpp.AppendLine();
 
-            // uniprot_id => { low, length, string_table_index... }
-            outHpp.AppendLine("// uniprot_id => [low, length, string_table_index...]");
-            outHpp.AppendLine("extern map<string, tuple<int, int, string, vector<short>>> numbering_data;");
+            // uniprot_id => { low, length, residues, runs of { offset, count, first_string_table_index }... }
+            outHpp.AppendLine("// uniprot_id => [low, length, residues, runs of [offset, count, first_string_table_index]...]");
+            outHpp.AppendLine("extern map<string, tuple<int, int, string, vector<array<short, 3>>>> numbering_data;");
 
-            outCpp.AppendLine("// uniprot_id => [low, length, string_table_index...]");
-            outCpp.AppendLine("map<string, tuple<int, int, string, vector<short>>> numbering_data =");
+            outCpp.AppendLine("// uniprot_id => [low, length, residues, runs of [offset, count, first_string_table_index]...]");
+            outCpp.AppendLine("map<string, tuple<int, int, string, vector<array<short, 3>>>> numbering_data =");
             outCpp.AppendLine("{");
             foreach (var (uniprot_id, numbering) in flatNumberingDict)
             {
                 int min = numbering.Keys.Min(), len = numbering.Keys.Max() - min + 1;
+
+                // consecutive string indices on consecutive residues collapse into one run
+                var runs = new List<(int offset, int count, int first)>();
+                for (int i = 0; i < len; i++)
+                {
+                    if (!numbering.TryGetValue(min + i, out string str))
+                        continue;
+                    int index = strings[str];
+                    if (runs.Count > 0 && runs[^1].offset + runs[^1].count == i && runs[^1].first + runs[^1].count == index)
+                        runs[^1] = (runs[^1].offset, runs[^1].count + 1, runs[^1].first);
+                    else
+                        runs.Add((i, 1, index));
+                }
+
                 outCpp.AppendLine($"\t{{");
                 outCpp.AppendLine($"\t\t\"{uniprot_id}\",");
                 outCpp.AppendLine($"\t\t{{");
                 outCpp.AppendLine($"\t\t\t{min}, {len},");
                 outCpp.AppendLine($"\t\t\t\"{string.Join("", Enumerable.Range(min, len).Select(i => residueNameDict[uniprot_id].TryGetValue(i, out char res) ? res : '.'))}\",");
-                outCpp.AppendLine($"\t\t\t{{{string.Join(", ", Enumerable.Range(min, len).Select(i => numbering.TryGetValue(i, out string str) ? strings[str] : -1))}}}");
+                outCpp.AppendLine($"\t\t\t{{{string.Join(", ", runs.Select(r => $"{{{r.offset}, {r.count}, {r.first}}}"))}}}");
                 outCpp.AppendLine($"\t\t}}");
                 outCpp.AppendLine($"\t}},");
             }
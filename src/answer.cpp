@@ -0,0 +1,827 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <regex>
+#include <set>
+#include <sstream>
+#include "answer.hpp"
+#include "complete.hpp"
+#include "compress.hpp"
+#include "database.hpp"
+#include "fuzzy.hpp"
+#include "lookup.hpp"
+#include "metrics.hpp"
+#include "numbering.hpp"
+#include "output.hpp"
+#include "repl.hpp"
+#include "scan.hpp"
+#include "string.hpp"
+using namespace std;
+
+map<char, string> res_names =
+{
+	// Charged (side chains often make salt bridges},
+	{ 'R', "ARG" }, // Arginine,
+	{ 'K', "LYS" }, // Lysine,
+	{ 'D', "ASP" }, // AsparticAcid,
+	{ 'E', "GLU" }, // GlutamicAcid,
+
+	// Polar (usually participate in hydrogen bonds as proton donors or acceptors},
+	{ 'Q', "GLN" }, // Glutamine,
+	{ 'N', "ASN" }, // Asparagine,
+	{ 'H', "HIS" }, // Histidine,
+	{ 'S', "SER" }, // Serine,
+	{ 'T', "THR" }, // Threonine,
+	{ 'Y', "TYR" }, // Tyrosine,
+	{ 'C', "CYS" }, // Cysteine,
+	{ 'W', "TRP" }, // Tryptophan,
+
+	// Hydrophobic (normally buried inside the protein core},
+	{ 'A', "ALA" }, // Alanine,
+	{ 'I', "ILE" }, // Isoleucine,
+	{ 'L', "LEU" }, // Leucine,
+	{ 'M', "MET" }, // Methionine,
+	{ 'F', "PHE" }, // Phenylalanine,
+	{ 'V', "VAL" }, // Valine,
+	{ 'P', "PRO" }, // Proline,
+	{ 'G', "GLY" }, // Glycine
+};
+
+array<pair<int, string>, 6> header_fmts =
+{ {
+	{ 14, "Protein" },
+	{ 9,  "Gene" },
+	{ 10, "Uniprot" },
+	{ 5,  "Res" },
+	{ 6,  "Seq" },
+	{ 0,  "Numbering" },
+} };
+
+// the entry of a key in one of the tables, or an empty one if it has none
+template<class Map>
+static const typename Map::mapped_type& entry_of(const Map& dict, const string& key)
+{
+	static const typename Map::mapped_type empty{};
+	auto it = dict.find(key);
+	return it == dict.end() ? empty : it->second;
+}
+
+void output_line(ostream& out, const array<bool, header_fmts.size()>& no_cols, int last_col, const string& scheme)
+{
+	for (int i = 0; i < (int)header_fmts.size(); i++)
+	{
+		if (no_cols[i])
+			continue;
+		if (i != last_col)
+			out << left << setw(header_fmts[i].first);
+		out << header_fmts[i].second;
+		if (i == last_col)
+			out << endl;
+	}
+}
+
+void output_line(ostream& out, const array<bool, header_fmts.size()>& no_cols, int last_col, const array<bool, header_fmts.size()>& highlights, const string& uniprot, const string& seq, const string& numbering, const char& res_name, fgcolor hlcolor)
+{
+	auto& t = tables();
+	auto [symbol, species, gene_name, long_species] = entry_of(t.uniprot_dict, uniprot);
+
+	vector<string> fields
+	{
+		symbol + '_' + species,
+		gene_name,
+		uniprot,
+		res_names.count(res_name) ? res_names[res_name] : "?",
+		res_names.count(res_name) ? res_name + seq : "?" + seq,
+		numbering,
+	};
+
+	for (int i = 0; i < (int)header_fmts.size(); i++)
+	{
+		if (no_cols[i])
+			continue;
+		if (highlights[i] && hlcolor != fgcolor::none)
+			out << hlcolor;
+		if (i != last_col)
+			out << left << setw(header_fmts[i].first);
+		out << fields[i];
+		if (highlights[i] && hlcolor != fgcolor::none)
+			out << fgcolor::none;
+		if (i == last_col)
+			out << endl;
+	}
+}
+
+void output_row(ostream& out, const query_options& opts, const array<bool, header_fmts.size()>& highlights, const string& uniprot, const string& seq, const string& numbering, char res_name)
+{
+	auto& t = tables();
+	if (!opts.json)
+	{
+		output_line(out, opts.no_cols, opts.last_col, highlights, uniprot, seq, numbering, res_name, opts.hlcolor);
+		return;
+	}
+
+	auto [symbol, species, gene_name, long_species] = entry_of(t.uniprot_dict, uniprot);
+	auto known = res_names.count(res_name);
+	auto label = trim(string(numbering));
+	out << ",{\"uniprot\":\"" << json_escape(uniprot)
+		<< "\",\"protein\":\"" << json_escape(symbol + '_' + species)
+		<< "\",\"gene\":\"" << json_escape(gene_name)
+		<< "\",\"residue\":" << (known ? '"' + string(1, res_name) + '"' : string("null"))
+		<< ",\"residue_name\":" << (known ? '"' + res_names[res_name] + '"' : string("null"))
+		<< ",\"sequence\":" << (seq == "?" ? string("null") : seq)
+		<< ",\"numbering\":" << (label == "?" || label.empty() ? string("null") : '"' + json_escape(label) + '"')
+		<< '}';
+}
+
+bool resolve_target(const string& target, vector<string>& uids, array<bool, header_fmts.size()>& highlights)
+{
+	auto& t = tables();
+	// only target is blank
+	if (target.empty())
+	{
+		for (auto [uid, pn] : t.uniprot_dict)
+			uids.push_back(uid);
+	}
+	// uniprot_id: P28223
+	// species: Human
+	else if (t.uniprot_dict.count(target))
+	{
+		highlights[(int)headers::uniprot] = true;
+		uids.push_back(target);
+	}
+	// pdb_id: 6A93
+	else if (t.pdb_id_dict.count(target)) // unique
+	{
+		//highlights[(int)headers::pdbid] = true;
+		uids.push_back(t.pdb_id_dict.at(target));
+	}
+	// gene name: HTR2A
+	else if (t.gene_name_dict.count(target)) // could be multiple
+	{
+		highlights[(int)headers::gene] = true;
+		auto [lo, hi] = t.gene_name_dict.equal_range(target);
+		for (; lo != hi; ++lo)
+			uids.push_back(lo->second);
+	}
+	// protein_symbol_species: 5HT2A_HUMAN
+	else if (t.symbol_species_dict.count(target)) // unique
+	{
+		highlights[(int)headers::symbol] = true;
+		uids.push_back(t.symbol_species_dict.at(target));
+	}
+	// protein_symbol: 5HT2A
+	else if (t.symbol_dict.count(target)) // could be multiple
+	{
+		highlights[(int)headers::symbol] = true;
+		auto [lo, hi] = t.symbol_dict.equal_range(target);
+		for (; lo != hi; ++lo)
+			uids.push_back(lo->second);
+	}
+	else
+	{
+		return false;
+	}
+	return true;
+}
+
+bool select_receptors(const string& target, const string& shown, bool fuzzy, const bitmap* filter, vector<string>& uids, array<bool, header_fmts.size()>& highlights, ostream& err)
+{
+	if (!resolve_target(target, uids, highlights))
+	{
+		auto suggestions = suggest_targets(target);
+
+		// a near-match is unambiguous when no other candidate is as close
+		if (fuzzy && suggestions.size() && (suggestions.size() == 1 || suggestions[0].first < suggestions[1].first))
+		{
+			err << "WARNING: unknown target '" << shown << "'; assuming '" << suggestions[0].second << "'" << endl;
+			resolve_target(suggestions[0].second, uids, highlights);
+		}
+		else
+		{
+			err << "ERROR: unknown target '" << shown << "'; ";
+			if (suggestions.size())
+			{
+				err << "did you mean ";
+				for (size_t i = 0; i < suggestions.size(); i++)
+					err << (i == 0 ? "" : i + 1 == suggestions.size() ? " or " : ", ") << '\'' << suggestions[i].second << '\'';
+				err << '?' << endl;
+			}
+			else
+			{
+				err << "use uniprot id, gene name, protein symbol or pdb id for a GPCR" << endl;
+			}
+			return false;
+		}
+	}
+
+	// keep only the receptors selected by --where
+	if (filter)
+		uids.erase(remove_if(uids.begin(), uids.end(), [filter](auto& uid) { return !filter->test(receptor_ordinal(uid)); }), uids.end());
+	return true;
+}
+
+// answers a transfer query <source>:<numbering>->[<target>,...] with the residues equivalent to the source residue, that is,
+// carrying its label in the scheme, in every target receptor or in all receptors if no target is given
+static int evaluate_transfer(const query_options& opts, const string& query, const string& source, const string& numbering, const string& targets, ostream& out, ostream& err, int& rows)
+{
+	auto& t = tables();
+	auto [offset, width, names] = t.schemes[opts.scheme_id];
+
+	// the source must be one receptor
+	auto source_target = trim(string(source));
+	transform(source_target.begin(), source_target.end(), source_target.begin(), ::toupper);
+	vector<string> sources;
+	array<bool, header_fmts.size()> source_highlights{};
+	if (source_target.empty())
+	{
+		err << "ERROR: invalid query '" << query << "'; a transfer needs a source receptor: '<target>:<numbering>->[<target>,...]'" << endl;
+		return 2;
+	}
+	if (!select_receptors(source_target, source, opts.fuzzy, nullptr, sources, source_highlights, err))
+		return 2;
+	if (sources.size() != 1)
+	{
+		err << "ERROR: ambiguous source '" << source << "' of " << sources.size() << " receptors; use one of " << join(", ", sources.begin(), sources.end()) << endl;
+		return 2;
+	}
+	auto& uid = sources[0];
+
+	auto position = trim(string(numbering));
+	transform(position.begin(), position.end(), position.begin(), ::tolower);
+	int seq, stridx;
+	char res_name;
+	auto kind = classify_numbering(position, width);
+	if (kind == query_kind::seq)
+	{
+		seq = stoi(position);
+	}
+	else if (kind == query_kind::label)
+	{
+		if (!get_seq_for_label(uid, opts.scheme_id, position, seq))
+		{
+			err << "ERROR: no residue of '" << source << "' is numbered '" << numbering << "' in scheme '" << names[0] << "'" << endl;
+			return 2;
+		}
+	}
+	else
+	{
+		err << "ERROR: invalid numbering '" << numbering << "' for scheme '" << names[0] << "'" << endl;
+		return 2;
+	}
+
+	if (!get_index_for_seq(uid, seq, stridx, res_name) || get_equivalent_residues(opts.scheme_id, stridx).empty())
+	{
+		err << "ERROR: residue " << seq << " of '" << source << "' has no numbering in scheme '" << names[0] << "'" << endl;
+		return 2;
+	}
+	auto& equivalents = get_equivalent_residues(opts.scheme_id, stridx);
+
+	// the targets in the order given, each receptor once
+	vector<string> uids;
+	array<bool, header_fmts.size()> highlights{};
+	if (trim(string(targets)).empty())
+	{
+		select_receptors("", "", opts.fuzzy, opts.filter, uids, highlights, err);
+	}
+	else
+	{
+		for (auto& item : split(targets, ','))
+		{
+			auto shown = trim(string(item)), target = shown;
+			transform(target.begin(), target.end(), target.begin(), ::toupper);
+			if (target.empty() || !select_receptors(target, shown, opts.fuzzy, opts.filter, uids, highlights, err))
+			{
+				if (target.empty())
+					err << "ERROR: invalid query '" << query << "'; empty target in the transfer list" << endl;
+				return 2;
+			}
+		}
+		set<string> seen;
+		uids.erase(remove_if(uids.begin(), uids.end(), [&](auto& u) { return !seen.insert(u).second; }), uids.end());
+	}
+
+	highlights[(int)headers::sequence] = true;
+	for (auto& target_uid : uids)
+	{
+		int ordinal = receptor_ordinal(target_uid);
+		auto it = lower_bound(equivalents.begin(), equivalents.end(), ordinal, [](auto& e, int o) { return e.receptor < o; });
+		if (it != equivalents.end() && it->receptor == ordinal)
+		{
+			output_row(out, opts, highlights, target_uid, to_string(it->seq), t.string_table[it->index].substr(offset, width), it->res_name);
+			++rows;
+		}
+		else if (opts.show_unmatched)
+		{
+			output_row(out, opts, highlights, target_uid, "?", t.string_table[stridx].substr(offset, width), '?');
+			++rows;
+		}
+	}
+	return 0;
+}
+
+int evaluate(const query_options& opts, const string& query, ostream& out, ostream& err, int& rows)
+{
+	auto& t = tables();
+	smatch ms;
+	if (!regex_match(query, ms, regex("([^:]*):(.*)")))
+	{
+		err << "ERROR: invalid query '" << query << "'; the correct form is '<target>:<numbering>'" << endl;
+		return 2;
+	}
+
+	string target = ms[1].str(), numbering = ms[2].str();
+	transform(target.begin(), target.end(), target.begin(), ::toupper);
+	transform(numbering.begin(), numbering.end(), numbering.begin(), ::tolower);
+
+	auto [offset, width, names] = t.schemes[opts.scheme_id];
+	auto kind = classify_numbering(numbering, width);
+	if (kind == query_kind::transfer)
+	{
+		auto arrow = ms[2].str().find("->");
+		return evaluate_transfer(opts, query, ms[1].str(), ms[2].str().substr(0, arrow), ms[2].str().substr(arrow + 2), out, err, rows);
+	}
+
+	// a filter narrows the receptors enough to allow a full dump
+	if (target.empty() && kind == query_kind::dump && !opts.filter)
+	{
+		err << "ERROR: invalid query '" << query << "'; at least a target or a numbering is required" << endl;
+		return 2;
+	}
+
+	vector<string> uids;
+	array<bool, header_fmts.size()> highlights{};
+
+	if (!select_receptors(target, ms[1].str(), opts.fuzzy, opts.filter, uids, highlights, err))
+		return 2;
+
+	// all residue numberings
+	if (kind == query_kind::dump)
+	{
+		for (auto& uid : uids)
+		{
+			auto it = t.numbering_data.find(uid);
+			if (it == t.numbering_data.end())
+				continue;
+
+			for_each_residue(it->second, [&](int seq, int stridx, char res_name)
+			{
+				output_row(out, opts, highlights, uid, to_string(seq), t.string_table[stridx].substr(offset, width), res_name);
+				++rows;
+			});
+		}
+	}
+	// numbering is a list of residue constraints: 3.32=D,6.48=W
+	else if (kind == query_kind::constraint)
+	{
+		vector<residue_constraint> constraints;
+		if (!parse_constraints(numbering, width, constraints))
+		{
+			err << "ERROR: invalid residue constraint '" << ms[2].str() << "'; the correct form is '<numbering>=<residues>[,<numbering>=<residues>...]'" << endl;
+			return 2;
+		}
+
+		highlights[(int)headers::residue] = true;
+
+		// a receptor is output only if it satisfies every constraint, with one line per constraint
+		vector<tuple<int, int, char>> positions(constraints.size());
+		for (auto& uid : uids)
+		{
+			bool hit = true;
+			for (size_t i = 0; hit && i < constraints.size(); i++)
+			{
+				auto& [seq, stridx, res_name] = positions[i];
+				hit = match_constraint(uid, opts.scheme_id, constraints[i], seq, stridx, res_name);
+			}
+			if (!hit)
+				continue;
+
+			for (auto& [seq, stridx, res_name] : positions)
+			{
+				output_row(out, opts, highlights, uid, to_string(seq), t.string_table[stridx].substr(offset, width), res_name);
+				++rows;
+			}
+		}
+	}
+	// numbering is a residue sequence
+	else if (kind == query_kind::seq)
+	{
+		highlights[(int)headers::sequence] = true;
+		int seq = stoi(numbering);
+		for (auto& uid : uids)
+		{
+			int stridx;
+			char res_name;
+			if (get_index_for_seq(uid, seq, stridx, res_name))
+			{
+				output_row(out, opts, highlights, uid, to_string(seq), t.string_table[stridx].substr(offset, width), res_name);
+				++rows;
+			}
+			else if (opts.show_unmatched)
+			{
+				output_row(out, opts, highlights, uid, to_string(seq), "?", '?');
+				++rows;
+			}
+		}
+	}
+	// numbering is a residue numbering
+	else if (kind == query_kind::label)
+	{
+		highlights[(int)headers::numbering] = true;
+
+		// the rows carrying the label come from one bulk scan of the scheme column,
+		// unless the label has blanks whose handling by iequals the scan does not mirror
+		vector<char> labeled;
+		bool scanned = none_of(numbering.begin(), numbering.end(), ::isspace);
+		if (scanned)
+			scan_label(opts.scheme_id, numbering, labeled);
+
+		for (auto& uid : uids)
+		{
+			auto& [min_seq, seq_count, seq_names, runs] = entry_of(t.numbering_data, uid);
+			bool hit = false;
+
+			for (auto run = runs.begin(); !hit && run != runs.end(); ++run)
+			{
+				auto& [start, count, first] = *run;
+				for (int i = 0; !hit && i < count; i++)
+				{
+					auto str = t.string_table[first + i].substr(offset, width);
+					hit = scanned ? labeled[first + i] : iequals(str, numbering);
+
+					if (hit)
+					{
+						output_row(out, opts, highlights, uid, to_string(min_seq + start + i), str, seq_names[start + i]);
+						++rows;
+					}
+				}
+			}
+
+			if (!hit && opts.show_unmatched)
+			{
+				output_row(out, opts, highlights, uid, "?", ms[2].str(), '?');
+				++rows;
+			}
+		}
+	}
+	// unknown numbering
+	else
+	{
+		err << "ERROR: invalid numbering '" << ms[2].str() << "' for scheme '" << names[0] << "'" << endl;
+		return 2;
+	}
+
+	return 0;
+}
+
+// queries differing only in the letter case of their target share a key; the numbering stays as typed because
+// unmatched rows echo it
+static string cache_key(const query_options& opts, const string& query, size_t colon)
+{
+	auto key = opts.cache_context + query;
+	auto first = key.begin() + opts.cache_context.size();
+	transform(first, first + colon, first, ::toupper);
+	return key;
+}
+
+shared_ptr<const cached_result> cached_answer(const query_options& opts, result_cache* cache, const string& query, string& key)
+{
+	auto colon = query.find(':');
+	if (!cache || colon == string::npos)
+		return nullptr;
+	key = cache_key(opts, query, colon);
+	auto result = cache->get(key);
+	return result && (result->spelling.empty() || result->spelling == query) ? result : nullptr;
+}
+
+// prints the header if no line has been output yet
+static void emit_header(const query_options& opts, int& line_no)
+{
+	auto& t = tables();
+	if (!opts.no_headers && !line_no)
+	{
+		output_line(cout, opts.no_cols, opts.last_col, get<2>(t.schemes[opts.scheme_id])[1]);
+		++line_no;
+	}
+}
+
+// prints an answer with its warnings, preceded by the header if it is the first one
+static void emit(const query_options& opts, int& line_no, const cached_result& result)
+{
+	cerr << result.messages;
+	emit_header(opts, line_no);
+	cout.write(result.bytes.data(), result.bytes.size());
+	line_no += result.rows;
+}
+
+// answers larger than this are not cached
+static const size_t cached_answer_limit = 1 << 20;
+
+int process(const query_options& opts, result_cache* cache, int& line_no, const string& query)
+{
+	query_timer timer(query);
+	string key;
+	auto result = cached_answer(opts, cache, query, key);
+
+	// errors are not cached and get reported on every occurrence; warnings are cached with the answer
+	if (!result)
+	{
+		// full dumps and answers too large for the cache are written into the output as they are formatted, which lets
+		// the output backend write the start of them while the rest is formatted; they come after any errors, so an
+		// answer that spills is one that succeeds
+		auto colon = query.find(':');
+		bool dump = colon != string::npos && classify_numbering(query.substr(colon + 1), SIZE_MAX) == query_kind::dump;
+		ostringstream messages;
+		spill_buffer buffer(key.empty() || dump ? 0 : min(cached_answer_limit, cache->largest()), cout.rdbuf(), [&]
+		{
+			cerr << messages.str();
+			emit_header(opts, line_no);
+		});
+		ostream out(&buffer);
+		auto r = make_shared<cached_result>();
+		int retcode = evaluate(opts, query, out, messages, r->rows);
+		if (retcode)
+		{
+			cerr << messages.str();
+			return retcode;
+		}
+		r->bytes = buffer.finish();
+		if (buffer.spilled())
+		{
+			timer.answered(r->rows);
+			line_no += r->rows;
+			return 0;
+		}
+		r->messages = messages.str();
+		if (r->messages.size())
+			r->spelling = query;
+		if (key.size())
+			cache->put(key, r);
+		result = r;
+	}
+
+	timer.answered(result->rows);
+	emit(opts, line_no, *result);
+	return 0;
+}
+
+// a sequence number or label query planned for a sweep over its receptors
+struct planned_query
+{
+	bool planned = false;
+	bool by_seq = false;
+	int seq = 0;
+	string label;    // lowercase label if !by_seq
+	string shown;    // the numbering as typed
+	vector<string> uids;
+	vector<tuple<int, int, char>> hits; // per receptor: sequence number, string index or -1 if unmatched, residue name
+	array<bool, header_fmts.size()> highlights{};
+	string key;
+	shared_ptr<const cached_result> result;
+};
+
+const vector<string>& folded_labels(int scheme_id)
+{
+	static array<table_cache<vector<string>>, scheme_count> labels;
+	return labels[scheme_id].get([scheme_id]
+	{
+		auto& t = tables();
+		vector<string> r;
+		auto [offset, width, names] = t.schemes[scheme_id];
+		for (auto& row : t.string_table)
+		{
+			auto label = row.substr(offset, width);
+			while (label.size() && isspace(label.back()))
+				label.pop_back();
+			transform(label.begin(), label.end(), label.begin(), ::tolower);
+			r.push_back(label);
+		}
+		return r;
+	});
+}
+
+int process_block(const query_options& opts, result_cache* cache, int& line_no, const vector<string>& queries, bool ignore_errors)
+{
+	auto& t = tables();
+	auto [offset, width, names] = t.schemes[opts.scheme_id];
+	vector<planned_query> plans(queries.size());
+	map<string, pair<vector<string>, array<bool, header_fmts.size()>>> targets;
+	map<string, vector<pair<size_t, size_t>>> groups; // uniprot_id => [query index, receptor position]
+
+	for (size_t i = 0; i < queries.size(); i++)
+	{
+		auto& query = queries[i];
+		auto& p = plans[i];
+		auto colon = query.find(':');
+		if (colon == string::npos)
+			continue;
+
+		string target = query.substr(0, colon), numbering = query.substr(colon + 1);
+		transform(target.begin(), target.end(), target.begin(), ::toupper);
+		transform(numbering.begin(), numbering.end(), numbering.begin(), ::tolower);
+
+		// leave full dumps, constraints, transfers, invalid numberings and blanks that iequals treats specially to process()
+		auto kind = classify_numbering(numbering, width);
+		if (kind == query_kind::seq)
+		{
+			p.by_seq = true;
+			p.seq = stoi(numbering);
+		}
+		else if (kind == query_kind::label && none_of(numbering.begin(), numbering.end(), ::isspace))
+		{
+			p.label = numbering;
+		}
+		else
+		{
+			continue;
+		}
+
+		auto target_it = targets.find(target);
+		if (target_it == targets.end())
+		{
+			vector<string> uids;
+			array<bool, header_fmts.size()> highlights{};
+			if (!resolve_target(target, uids, highlights))
+				continue;
+			if (opts.filter)
+				uids.erase(remove_if(uids.begin(), uids.end(), [&](auto& uid) { return !opts.filter->test(receptor_ordinal(uid)); }), uids.end());
+			target_it = targets.emplace(target, make_pair(move(uids), highlights)).first;
+		}
+
+		p.planned = true;
+		p.shown = query.substr(colon + 1);
+		if ((p.result = cached_answer(opts, cache, query, p.key)))
+			continue;
+
+		p.uids = target_it->second.first;
+		p.highlights = target_it->second.second;
+		p.highlights[(int)(p.by_seq ? headers::sequence : headers::numbering)] = true;
+		p.hits.assign(p.uids.size(), { 0, -1, 0 });
+		for (size_t u = 0; u < p.uids.size(); u++)
+			groups[p.uids[u]].emplace_back(i, u);
+	}
+
+	// one sweep per receptor: sequence numbers index the numbering directly, labels are looked up in sorted order
+	auto& labels = folded_labels(opts.scheme_id);
+	for (auto& [uid, members] : groups)
+	{
+		auto it = t.numbering_data.find(uid);
+		if (it == t.numbering_data.end())
+			continue;
+		vector<pair<string, size_t>> pending; // label => member
+		for (size_t m = 0; m < members.size(); m++)
+		{
+			auto& [qi, u] = members[m];
+			auto& p = plans[qi];
+			if (!p.by_seq)
+				pending.emplace_back(p.label, m);
+			else if (auto& [seq, stridx, res_name] = p.hits[u]; find_residue(it->second, p.seq, stridx, res_name))
+				seq = p.seq;
+		}
+		sort(pending.begin(), pending.end());
+
+		// the first residue carrying a label answers it, and the sweep ends once every label is answered
+		auto& [min_seq, seq_count, seq_names, runs] = it->second;
+		size_t unanswered = pending.size();
+		for (auto run = runs.begin(); unanswered && run != runs.end(); ++run)
+		{
+			auto& [start, count, first] = *run;
+			for (int i = 0; unanswered && i < count; i++)
+			{
+				auto& label = labels[first + i];
+				for (auto lo = lower_bound(pending.begin(), pending.end(), make_pair(label, (size_t)0)); lo != pending.end() && lo->first == label; ++lo)
+				{
+					auto& [qi, u] = members[lo->second];
+					auto& hit = plans[qi].hits[u];
+					if (get<1>(hit) == -1)
+					{
+						hit = { min_seq + start + i, first + i, seq_names[start + i] };
+						--unanswered;
+					}
+				}
+			}
+		}
+	}
+
+	for (size_t i = 0; i < queries.size(); i++)
+	{
+		auto& p = plans[i];
+		if (!p.planned)
+		{
+			int retcode = process(opts, cache, line_no, queries[i]);
+			if (!ignore_errors && retcode)
+				return retcode;
+			continue;
+		}
+
+		if (!p.result)
+		{
+			ostringstream out;
+			auto r = make_shared<cached_result>();
+			for (size_t u = 0; u < p.uids.size(); u++)
+			{
+				auto& [seq, stridx, res_name] = p.hits[u];
+				if (stridx != -1)
+					output_row(out, opts, p.highlights, p.uids[u], to_string(seq), t.string_table[stridx].substr(offset, width), res_name);
+				else if (!opts.show_unmatched)
+					continue;
+				else if (p.by_seq)
+					output_row(out, opts, p.highlights, p.uids[u], to_string(p.seq), "?", '?');
+				else
+					output_row(out, opts, p.highlights, p.uids[u], "?", p.shown, '?');
+				++r->rows;
+			}
+			r->bytes = out.str();
+			if (cache)
+				cache->put(p.key, r);
+			p.result = r;
+		}
+		count_query(queries[i], p.result->rows);
+		emit(opts, line_no, *p.result);
+	}
+	return 0;
+}
+
+string settings_key(const query_options& opts)
+{
+	string key;
+	for (auto no_col : opts.no_cols)
+		key += no_col ? '1' : '0';
+	return key + (opts.show_unmatched ? "u" : "") + (opts.fuzzy ? "f" : "") + (opts.filter ? "w" : "") + to_string(opts.scheme_id) + '/' + to_string((int)opts.hlcolor) + '\t';
+}
+
+int answer_queries(const query_options& opts, result_cache* cache, const query_input& input)
+{
+	// with --plan, queries are collected and answered a block at a time
+	vector<string> block;
+	int line_no = 0;
+
+	auto flush_block = [&]
+	{
+		int retcode = process_block(opts, cache, line_no, block, input.ignore_errors);
+		block.clear();
+		return retcode;
+	};
+
+	auto answer = [&](const string& query)
+	{
+		if (!input.plan)
+			return process(opts, cache, line_no, query);
+		block.push_back(query);
+		return block.size() < plan_block ? 0 : flush_block();
+	};
+
+	bool any = false;
+	if (input.queries.size())
+	{
+		for (auto& query : input.queries)
+		{
+			int retcode = answer(query);
+			if (!input.ignore_errors && retcode)
+				return retcode;
+		}
+		if (int retcode = flush_block(); !input.ignore_errors && retcode)
+			return retcode;
+		any = true;
+	}
+
+	// query files and stdin are read, answered and written on separate threads
+	auto answer_lines = [&](const vector<string>& lines)
+	{
+		if (input.plan)
+			return process_block(opts, cache, line_no, lines, input.ignore_errors);
+		for (auto& line : lines)
+		{
+			int retcode = process(opts, cache, line_no, line);
+			if (!input.ignore_errors && retcode)
+				return retcode;
+		}
+		return 0;
+	};
+
+	if (!input.file.empty())
+	{
+		auto in = open_input(input.file);
+		if (int retcode = run_pipeline(*in, input.pipeline, answer_lines); !input.ignore_errors && retcode)
+			return retcode;
+		any = true;
+	}
+
+	if (!any && input.interactive)
+	{
+		auto completer = [&](const string& word) { return complete_query(word, opts.scheme_id, 100); };
+		run_repl("gpcrn> ", completer, [&](const string& line)
+		{
+			// every entered line is answered with its own header
+			line_no = 0;
+			for (auto& query : split(line, string(" \t")))
+				process(opts, cache, line_no, query);
+			cout << flush;
+		});
+	}
+	else if (!any)
+	{
+		if (int retcode = run_pipeline(cin, input.pipeline, answer_lines); !input.ignore_errors && retcode)
+			return retcode;
+	}
+	return 0;
+}
@@ -0,0 +1,149 @@
+#pragma once
+#include <array>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "cache.hpp"
+#include "filter.hpp"
+#include "pipeline.hpp"
+using namespace std;
+using namespace std::filesystem;
+
+//! Three-letter names of the one-letter residue names.
+extern map<char, string> res_names;
+
+//! The columns of the output, in order.
+enum class headers
+{
+	symbol,
+	gene,
+	uniprot,
+	residue,
+	sequence,
+	numbering,
+};
+
+//! The width and title of every column; the title of the last one is set to the scheme in use.
+extern array<pair<int, string>, 6> header_fmts;
+
+// see https://en.wikipedia.org/wiki/ANSI_escape_code#Colors
+enum class fgcolor
+{
+	none    = 0,
+	black   = 30, // Black   30 40
+	red     = 31, // Red     31 41
+	green   = 32, // Green   32 42
+	yellow  = 33, // Yellow  33 43
+	blue    = 34, // Blue    34 44
+	magenta = 35, // Magenta 35 45
+	cyan    = 36, // Cyan    36 46
+	white   = 37, // White   37 47
+	bright_black   = 90, // Bright Black   90 100
+	bright_red     = 91, // Bright Red     91 101
+	bright_green   = 92, // Bright Green   92 102
+	bright_yellow  = 93, // Bright Yellow  93 103
+	bright_blue    = 94, // Bright Blue    94 104
+	bright_magenta = 95, // Bright Magenta 95 105
+	bright_cyan    = 96, // Bright Cyan    96 106
+	bright_white   = 97, // Bright White   97 107
+};
+
+enum class bgcolor
+{
+	none    = 0,
+	black   = 40, // Black   30 40
+	red     = 41, // Red     31 41
+	green   = 42, // Green   32 42
+	yellow  = 43, // Yellow  33 43
+	blue    = 44, // Blue    34 44
+	magenta = 45, // Magenta 35 45
+	cyan    = 46, // Cyan    36 46
+	white   = 47, // White   37 47
+	bright_black   = 100, // Bright Black   90 100
+	bright_red     = 101, // Bright Red     91 101
+	bright_green   = 102, // Bright Green   92 102
+	bright_yellow  = 103, // Bright Yellow  93 103
+	bright_blue    = 104, // Bright Blue    94 104
+	bright_magenta = 105, // Bright Magenta 95 105
+	bright_cyan    = 106, // Bright Cyan    96 106
+	bright_white   = 107, // Bright White   97 107
+};
+
+template <class _Traits>
+inline basic_ostream<char, _Traits>& operator<<(basic_ostream<char, _Traits>& _Ostr,
+	const fgcolor& color)
+{
+	return _Ostr << "\x1b[" << (int)color << "m";
+}
+
+//! Settings shaping the output of every query in a run.
+struct query_options
+{
+	array<bool, header_fmts.size()> no_cols{};
+	int last_col = 5;
+	bool no_headers = false;
+	bool show_unmatched = false;
+	bool fuzzy = false;
+	const bitmap* filter = nullptr;
+	int scheme_id = 0;
+	fgcolor hlcolor = fgcolor::none;
+	bool json = false; // rows as comma-led JSON objects for the HTTP API instead of text lines
+	string cache_context; // prefix of cache keys identifying the settings above
+};
+
+//! Where the queries of a run come from and how they are answered.
+struct query_input
+{
+	vector<string> queries;    // given on the command line, answered first
+	path file;                 // a query file read after them, or empty
+	bool interactive = false;  // without a query or a file, lines are typed into the line editor rather than piped
+	bool plan = false;         // answered in blocks grouped by receptor
+	bool ignore_errors = false;
+	pipeline_options pipeline;
+};
+
+//! The number of queries --plan answers at once.
+const size_t plan_block = 4096;
+
+//! Identifies every setting of opts that changes the output, for the start of its cache keys.
+string settings_key(const query_options& opts);
+
+//! Writes the header line.
+void output_line(ostream& out, const array<bool, header_fmts.size()>& no_cols, int last_col, const string& scheme);
+
+//! Writes a row as a text line, with the highlighted columns in hlcolor.
+void output_line(ostream& out, const array<bool, header_fmts.size()>& no_cols, int last_col, const array<bool, header_fmts.size()>& highlights, const string& uniprot, const string& seq, const string& numbering, const char& res_name, fgcolor hlcolor);
+
+//! Writes one row of an answer, as a text line or, for the HTTP API, as a JSON object preceded by a comma.
+void output_row(ostream& out, const query_options& opts, const array<bool, header_fmts.size()>& highlights, const string& uniprot, const string& seq, const string& numbering, char res_name);
+
+//! Adds the receptors of an uppercase target, or of all receptors if it is empty, and highlights the column it
+//! matched; false if it is unknown.
+bool resolve_target(const string& target, vector<string>& uids, array<bool, header_fmts.size()>& highlights);
+
+//! Resolves a target with suggestions for unknown ones, then applies the --where filter.
+bool select_receptors(const string& target, const string& shown, bool fuzzy, const bitmap* filter, vector<string>& uids, array<bool, header_fmts.size()>& highlights, ostream& err);
+
+//! Evaluates a query into out without the header line, counting the output lines in rows; errors and warnings go to err.
+int evaluate(const query_options& opts, const string& query, ostream& out, ostream& err, int& rows);
+
+//! Looks up the answer of a query in the cache, setting its key; an answer quoting its target answers only the
+//! spelling it came from.
+shared_ptr<const cached_result> cached_answer(const query_options& opts, result_cache* cache, const string& query, string& key);
+
+//! Answers a query on cout, from the cache when possible, preceded by the header if line_no is still 0.
+int process(const query_options& opts, result_cache* cache, int& line_no, const string& query);
+
+//! String table rows folded for label comparison: lowercase without trailing blanks, which is what iequals ignores.
+const vector<string>& folded_labels(int scheme_id);
+
+//! Answers a block of queries grouped by receptor, so that each receptor is resolved and swept once per block;
+//! the answers keep the input order and anything beyond a plain sequence number or label query goes through process().
+int process_block(const query_options& opts, result_cache* cache, int& line_no, const vector<string>& queries, bool ignore_errors);
+
+//! Answers the queries of the command line, then those of the file, the line editor or stdin, the last two on the
+//! threads of run_pipeline(). Returns the first error unless errors are ignored.
+int answer_queries(const query_options& opts, result_cache* cache, const query_input& input);
@@ -0,0 +1,343 @@
+#ifndef _WIN32
+#include <csignal>
+#endif
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <boost/property_tree/json_parser.hpp>
+#include "api.hpp"
+#include "delta.hpp"
+#include "lookup.hpp"
+#include "metrics.hpp"
+#include "numbering.hpp"
+#include "release.hpp"
+#include "server.hpp"
+#include "string.hpp"
+using namespace std;
+using boost::property_tree::ptree;
+
+bool answer_json(const query_options& opts, result_cache* cache, const string& query, string& json)
+{
+	query_timer timer(query);
+	string key;
+	auto result = cached_answer(opts, cache, query, key);
+
+	// the cache holds the answer after the query, with -1 rows for an error, which is part of the answer here and
+	// quotes the target as typed
+	if (!result)
+	{
+		ostringstream out, errors;
+		auto r = make_shared<cached_result>();
+		int retcode;
+		try
+		{
+			retcode = evaluate(opts, query, out, errors, r->rows);
+		}
+		catch (exception& ex)
+		{
+			errors << "ERROR: " << ex.what() << endl;
+			retcode = 2;
+		}
+
+		if (retcode)
+		{
+			// the last message is the error, any before it warnings
+			auto message = trim(errors.str());
+			auto line = message.rfind('\n');
+			message = message.substr(line == string::npos ? 0 : line + 1);
+			if (starts_with(message, "ERROR: "))
+				message = message.substr(7);
+			r->bytes = "\"error\":\"" + json_escape(message) + "\"}";
+			r->rows = -1;
+			r->spelling = query;
+		}
+		else
+		{
+			// every row starts with a comma
+			auto rows = out.str();
+			r->bytes = "\"rows\":[" + (rows.size() ? rows.substr(1) : rows) + "]}";
+		}
+		if (key.size())
+			cache->put(key, r);
+		result = r;
+	}
+
+	if (result->rows >= 0)
+		timer.answered(result->rows);
+	json = "{\"query\":\"" + json_escape(query) + "\"," + result->bytes;
+	return result->rows >= 0;
+}
+
+void serve_api(const query_options& opts, result_cache* cache, const api_options& api)
+{
+	auto colon = api.address.rfind(':');
+	string host = colon == string::npos ? "127.0.0.1" : api.address.substr(0, colon), port = api.address.substr(colon + 1);
+	if (host.size() > 1 && host.front() == '[' && host.back() == ']')
+		host = host.substr(1, host.size() - 2);
+
+	auto json_opts = opts;
+	json_opts.json = true;
+	json_opts.hlcolor = fgcolor::none;
+	json_opts.cache_context = "json" + opts.cache_context;
+
+	auto fail = [](http_response& res, int status, const string& message)
+	{
+		res.status = status;
+		res.body = "{\"error\":\"" + json_escape(message) + "\"}";
+	};
+
+	// the receptors selected by --where, kept with each set of tables
+	table_cache<bitmap> selections;
+	auto select = [&] { return evaluate_filter(api.where); };
+
+	// rebuilds the database from its sources into a new set of tables and publishes it; requests keep reading the
+	// set they pinned and the replaced one is freed after the last of them
+	mutex reloading;
+	auto reload = [&]
+	{
+		lock_guard<mutex> guard(reloading);
+
+		// a release named builtin or by the version of the built-in tables is read from them, as at startup
+		tables_pin base(api.builtin);
+		database_tables t;
+		if (api.release.size())
+			t = load_release(api.releases_dir, api.release);
+		else if (!api.database_file.empty())
+			t = load_database(api.database_file);
+		else
+			t = *api.builtin;
+		for (auto& delta : api.deltas)
+		{
+			ifstream in(delta);
+			if (!in)
+				throw runtime_error("cannot open delta file '" + delta.string() + "'");
+			apply_delta(t, in, delta.string());
+		}
+
+		// the selection is made before publishing, so that no request reads a set it fails on
+		auto loaded = make_shared<const database_tables>(move(t));
+		if (opts.filter)
+		{
+			tables_pin pin(loaded);
+			selections.get(select);
+		}
+		publish_tables(loaded);
+		if (cache)
+			cache->clear();
+		return loaded->version;
+	};
+
+	// from here on the tables may be replaced under any thread not pinning them
+	allow_reloads();
+
+#ifndef _WIN32
+	// SIGHUP is taken by a thread of its own, so it is blocked before the workers inherit the signal mask
+	sigset_t hangup;
+	sigemptyset(&hangup);
+	sigaddset(&hangup, SIGHUP);
+	pthread_sigmask(SIG_BLOCK, &hangup, nullptr);
+	thread([&, hangup]
+	{
+		for (int signal; sigwait(&hangup, &signal) == 0;)
+		{
+			try
+			{
+				cerr << "INFO: reloaded GPCRdb version " << reload() << endl;
+			}
+			catch (exception& ex)
+			{
+				cerr << "ERROR: reload failed; " << ex.what() << endl;
+			}
+		}
+	}).detach();
+#endif
+
+	auto handle = [&](const http_request& req, http_response& res)
+	{
+		if (req.path != "/query" && req.path != "/batch" && req.path != "/health" && req.path != "/metrics" && req.path != "/reload")
+			return fail(res, 404, "unknown path '" + req.path + "'; use /query, /batch, /health, /metrics or /reload");
+		bool post = req.path == "/batch" || req.path == "/reload";
+		if (req.method != (post ? "POST" : "GET"))
+			return fail(res, 405, req.path + (post ? " takes POST" : " takes GET"));
+
+		// a request reads one set of tables throughout, and answers cached from another one are not its own
+		tables_pin pin;
+		auto request_opts = json_opts;
+		request_opts.cache_context += to_string(tables().derived.identity()) + '\t';
+		if (opts.filter)
+			request_opts.filter = &selections.get(select);
+
+		if (req.path == "/health")
+		{
+			res.body = "{\"status\":\"ok\",\"version\":\"" + json_escape(api.version) + "\",\"gpcrdb\":\"" + json_escape(tables().version) + "\"}";
+		}
+		else if (req.path == "/metrics")
+		{
+			ostringstream out;
+			write_metrics(out, cache);
+			res.content_type = "text/plain; version=0.0.4";
+			res.body = out.str();
+		}
+		else if (req.path == "/reload")
+		{
+			try
+			{
+				res.body = "{\"status\":\"reloaded\",\"gpcrdb\":\"" + json_escape(reload()) + "\"}";
+			}
+			catch (exception& ex)
+			{
+				return fail(res, 500, string("reload failed; ") + ex.what());
+			}
+		}
+		else if (req.path == "/query")
+		{
+			auto query = trim(query_parameter(req.query, "q"));
+			if (query.empty())
+				return fail(res, 400, "missing query parameter 'q'");
+			if (!answer_json(request_opts, cache, query, res.body))
+				res.status = 400;
+		}
+		else
+		{
+			// a JSON array of queries, or one query per line
+			vector<string> lines;
+			auto body = trim(string(req.body));
+			if (starts_with(body, "["))
+			{
+				ptree tree;
+				try
+				{
+					istringstream in(body);
+					read_json(in, tree);
+				}
+				catch (exception&)
+				{
+					return fail(res, 400, "invalid JSON; send an array of query strings");
+				}
+				for (auto& [ignore, item] : tree)
+				{
+					if (!item.empty())
+						return fail(res, 400, "invalid JSON; send an array of query strings");
+					lines.push_back(trim(item.get_value<string>()));
+				}
+			}
+			else
+			{
+				for (auto& line : split(body, string("\r\n")))
+					if (trim(line).size() && line[0] != '#')
+						lines.push_back(line);
+			}
+
+			// errors are reported per query, the batch itself succeeds
+			res.body = "{\"results\":[";
+			string answer;
+			for (size_t i = 0; i < lines.size(); i++)
+			{
+				answer_json(request_opts, cache, lines[i], answer);
+				res.body += (i ? "," : "") + answer;
+			}
+			res.body += "]}";
+		}
+	};
+
+	int listener = listen_http(host, port);
+	cerr << "INFO: serving on http://" << (host.find(':') == string::npos ? host : '[' + host + ']') << ':' << port << " with " << max(1u, api.workers) << " workers" << endl;
+	serve_http(listener, api.workers, handle);
+}
+
+void answer_record(const query_options& opts, const shm_query& query, vector<shm_result>& results)
+{
+	auto& t = tables();
+	string target(query.target, strnlen(query.target, sizeof(query.target)));
+	string numbering(query.numbering, strnlen(query.numbering, sizeof(query.numbering)));
+	trim(target);
+	trim(numbering);
+	transform(target.begin(), target.end(), target.begin(), ::toupper);
+	transform(numbering.begin(), numbering.end(), numbering.begin(), ::tolower);
+	auto kind = classify_numbering(numbering, get<1>(t.schemes[opts.scheme_id]));
+	query_timer timer(kind);
+
+	// the status record ends the rows of an answer and stands alone for an error
+	auto status = [&](shm_status outcome, int rows) { results.push_back({ query.tag, -1, outcome, rows, 0, {} }); };
+
+	vector<string> uids;
+	array<bool, header_fmts.size()> highlights{};
+	if (!resolve_target(target, uids, highlights))
+		return status(shm_unknown_target, 0);
+
+	// a full dump needs a target or a filter, as in evaluate()
+	bool answerable = kind == query_kind::dump ? target.size() || opts.filter
+		: kind == query_kind::seq || (kind == query_kind::label && none_of(numbering.begin(), numbering.end(), ::isspace));
+	if (!answerable)
+		return status(shm_invalid_numbering, 0);
+	if (opts.filter)
+		uids.erase(remove_if(uids.begin(), uids.end(), [&](auto& uid) { return !opts.filter->test(receptor_ordinal(uid)); }), uids.end());
+
+	int rows = 0;
+	auto row = [&](const string& uid, int seq, int stridx, char res_name)
+	{
+		results.push_back({ query.tag, receptor_ordinal(uid), seq, stridx, stridx == -1 ? '?' : res_name, {} });
+		++rows;
+	};
+
+	if (kind == query_kind::dump)
+	{
+		for (auto& uid : uids)
+			if (auto it = t.numbering_data.find(uid); it != t.numbering_data.end())
+				for_each_residue(it->second, [&](int seq, int stridx, char res_name) { row(uid, seq, stridx, res_name); });
+	}
+	else if (kind == query_kind::seq)
+	{
+		int seq = stoi(numbering), stridx;
+		char res_name;
+		for (auto& uid : uids)
+		{
+			if (get_index_for_seq(uid, seq, stridx, res_name))
+				row(uid, seq, stridx, res_name);
+			else if (opts.show_unmatched)
+				row(uid, seq, -1, '?');
+		}
+	}
+	else
+	{
+		// the first residue carrying the label answers it, as in evaluate()
+		auto& labels = folded_labels(opts.scheme_id);
+		for (auto& uid : uids)
+		{
+			bool hit = false;
+			if (auto it = t.numbering_data.find(uid); it != t.numbering_data.end())
+			{
+				auto& [min_seq, seq_count, seq_names, runs] = it->second;
+				for (auto run = runs.begin(); !hit && run != runs.end(); ++run)
+				{
+					auto& [start, count, first] = *run;
+					for (int i = 0; !hit && i < count; i++)
+						if ((hit = labels[first + i] == numbering))
+							row(uid, min_seq + start + i, first + i, seq_names[start + i]);
+				}
+			}
+			if (!hit && opts.show_unmatched)
+				row(uid, -1, -1, '?');
+		}
+	}
+
+	timer.answered(rows);
+	status(shm_answered, rows);
+}
+
+void serve_records(const query_options& opts, const string& name, unsigned channels)
+{
+	auto& t = tables();
+	shm_tables layout;
+	layout.receptors = receptor_ids();
+	layout.strings = t.string_table;
+	layout.label_offset = get<0>(t.schemes[opts.scheme_id]);
+	layout.label_width = get<1>(t.schemes[opts.scheme_id]);
+
+	cerr << "INFO: serving shared memory /" << name << " with " << max(1u, channels) << " channels" << endl;
+	serve_shm(name, channels, layout, [&](const shm_query& query, vector<shm_result>& results) { answer_record(opts, query, results); });
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+#include "answer.hpp"
+#include "database.hpp"
+#include "shm.hpp"
+using namespace std;
+using namespace std::filesystem;
+
+//! Where gpcrn --serve listens and what it rebuilds its tables from on a reload.
+struct api_options
+{
+	string address;                             // [HOST:]PORT
+	unsigned workers = 1;
+	string version;                             // of gpcrn, reported by GET /health
+	string where;                               // the --where expression, evaluated again on every set of tables
+	shared_ptr<const database_tables> builtin;  // read when neither a database nor a release is chosen
+	string release;                             // a release of releases_dir, or empty
+	path releases_dir;
+	path database_file;                         // a database file, or empty
+	vector<path> deltas;                        // applied on top, in order
+};
+
+//! Answers a query for the HTTP API as {"query":...,"rows":[...]} or {"query":...,"error":...}; false on an error.
+bool answer_json(const query_options& opts, result_cache* cache, const string& query, string& json);
+
+//! Serves the HTTP API over the lookups and the cache of the command line until the process is stopped: GET /query,
+//! POST /batch, GET /health, GET /metrics, and POST /reload or SIGHUP to rebuild the tables from their sources.
+//! Throws runtime_error if the address cannot be bound.
+void serve_api(const query_options& opts, result_cache* cache, const api_options& api);
+
+//! Answers a binary query of the shared-memory transport with one record per row and a status record; residue
+//! constraints, transfers and labels with blanks are left to the text interfaces.
+void answer_record(const query_options& opts, const shm_query& query, vector<shm_result>& results);
+
+//! Serves binary query records through the shared memory segment /name until the process is stopped.
+void serve_records(const query_options& opts, const string& name, unsigned channels);
@@ -1,8 +1,11 @@
 #include "assets.hpp"
 
+// date of the GPCRdb snapshot
+string gpcrdb_version = "2021-05-14";
+
 // string_index => string
-array<string, 699> string_table =
-{{
+vector<string> string_table =
+{
 //   v      v      v      v      v      v        v        v        v        v         v      v      
 	"D1S1x49D1S1x49D1S1x49D1S1x49D1S1.49D1S1x49  D1S1x49  D1S1x49  D1S1x49  D1S1.49x49D1S1x49D1S1x49",
 	"D1S1x50D1S1x50D1S1x50D1S1x50D1S1.50D1S1x50  D1S1x50  D1S1x50  D1S1x50  D1S1.50x50D1S1x50D1S1x50",
@@ -704,7 +707,7 @@ array<string, 699> string_table =
 	"2.73   2.80   2.69   2.74   2.76   2.73x73  2.80x80  2.69x69  2.74x74  2.76x76   247    II:33  ",
 	"2.74   2.81   2.70   2.75   2.77   2.74x74  2.81x81  2.70x70  2.75x75  2.77x77   248    II:34  ",
 //   ^      ^      ^      ^      ^      ^        ^        ^        ^        ^         ^      ^      
-}};
+};
 
 // scheme_index => scheme_numbering_offset, scheme_numbering_length, scheme_names
 array<tuple<size_t, size_t, vector<string>>, 12> schemes =
@@ -834,6 +837,117 @@ map<string, tuple<string, string, string, string>> uniprot_dict =
 	{"P49146",   {"NPY2R",  "HUMAN", "NPY2R",     "Human"}},
 };
 
+// uniprot_id => class
+map<string, string> class_dict =
+{
+	{"D6VTK4",   "D1"},
+	{"P28222",   "A"},
+	{"P41597",   "A"},
+	{"P42866",   "A"},
+	{"Q16602",   "B1"},
+	{"P34972",   "A"},
+	{"P25025",   "A"},
+	{"Q08BG4",   "A"},
+	{"P30559",   "A"},
+	{"P18089",   "A"},
+	{"P55085",   "A"},
+	{"P41180",   "C"},
+	{"P41143",   "A"},
+	{"P43115",   "A"},
+	{"P41594",   "C"},
+	{"P30989",   "A"},
+	{"P02699",   "A"},
+	{"P14416",   "A"},
+	{"Q03431",   "B1"},
+	{"P07550",   "A"},
+	{"P29274",   "A"},
+	{"P21728",   "A"},
+	{"P28223",   "A"},
+	{"Q6IYF9",   "A"},
+	{"P08172",   "A"},
+	{"P51684",   "A"},
+	{"P21554",   "A"},
+	{"P21730",   "A"},
+	{"P08483",   "A"},
+	{"Q13324",   "B1"},
+	{"P34998-2", "B1"},
+	{"P61073",   "A"},
+	{"P47900",   "A"},
+	{"P07700",   "A"},
+	{"P48039",   "A"},
+	{"O43614",   "A"},
+	{"P32248",   "A"},
+	{"Q9NS75",   "A"},
+	{"Q86Y34",   "B2"},
+	{"Q99835",   "F"},
+	{"P47871",   "B1"},
+	{"P35367",   "A"},
+	{"P43220",   "B1"},
+	{"P11229",   "A"},
+	{"Q02643",   "B1"},
+	{"Q92633",   "A"},
+	{"P21917",   "A"},
+	{"P08908",   "A"},
+	{"P28566",   "A"},
+	{"P28221",   "A"},
+	{"P35462",   "A"},
+	{"P41145",   "A"},
+	{"P25116",   "A"},
+	{"P25105",   "A"},
+	{"P32245",   "A"},
+	{"Q9Y2T5",   "A"},
+	{"P08100",   "A"},
+	{"P08912",   "A"},
+	{"P24530",   "A"},
+	{"P30556",   "A"},
+	{"P21453",   "A"},
+	{"P25103",   "A"},
+	{"Q9ULV1",   "F"},
+	{"Q9Y271",   "A"},
+	{"P20789",   "A"},
+	{"P35408",   "A"},
+	{"P41595",   "A"},
+	{"P50052",   "A"},
+	{"Q8TDU6",   "A"},
+	{"P51686",   "A"},
+	{"P35414",   "A"},
+	{"O43613",   "A"},
+	{"P47872",   "B1"},
+	{"P30542",   "A"},
+	{"P41146",   "A"},
+	{"P51681",   "A"},
+	{"P41586",   "B1"},
+	{"Q9H244",   "A"},
+	{"P21731",   "A"},
+	{"P32241",   "B1"},
+	{"Q13255",   "C"},
+	{"P28335",   "A"},
+	{"P08173",   "A"},
+	{"Q80KM9",   "A"},
+	{"P25929",   "A"},
+	{"O14842",   "A"},
+	{"P30988",   "B1"},
+	{"Q9WTK1",   "A"},
+	{"Q9Y5Y4",   "A"},
+	{"B1B1U5",   "A"},
+	{"Q98SW5",   "F"},
+	{"P51436",   "A"},
+	{"P25090",   "A"},
+	{"P31356",   "A"},
+	{"P49286",   "A"},
+	{"P32300",   "A"},
+	{"P69332",   "A"},
+	{"Q13467",   "F"},
+	{"P56726",   "F"},
+	{"G1SGD4",   "B1"},
+	{"Q92847",   "A"},
+	{"P08913",   "A"},
+	{"Q15722",   "A"},
+	{"P18825",   "A"},
+	{"P30968",   "A"},
+	{"P49146",   "A"},
+};
+
 // symbol => uniprot_id
 multimap<string, string> symbol_dict =
 {
@@ -1705,15 +1819,15 @@ map<string, string> pdb_id_dict =
 	{"7L0Q", "P20789"},
 };
 
-// uniprot_id => [low, length, string_table_index...]
-map<string, tuple<int, int, string, vector<short>>> numbering_data =
+// uniprot_id => [low, length, residues, runs of [offset, count, first_string_table_index]...]
+map<string, tuple<int, int, string, vector<array<short, 3>>>> numbering_data =
 {
 	{
 		"D6VTK4",
 		{
 			18, 289,
 			"NPGQSTINYTSIYGNGSTITFDELQGLVNSTVTQAIMFGVRCGAAALTLIVMWMT.....TPIFIINQVSLFLIILHSALYFKYLLSNYSSVTYALTGFPQFISRGDVHVYGATNIIQVLLVASIETSLVFQIKVIFT.....RIGLMLTSISFTLGIATVTMYFVSAVKGMIVTYND.....DKYFNASTILLASSINFMSFVLVVKLILAIRSRRFL.....DSFHILLIMSCQSLLVPSIIFILAYSL.......VLTTVATLLAVLSLPLSSMWATAANNASKTN",
-			{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, -1, -1, -1, -1, -1, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, -1, -1, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, -1, -1, -1, -1, -1, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, -1, -1, -1, -1, -1, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, -1, -1, -1, -1, -1, -1, -1, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261}
+			{{0, 55, 0}, {60, 78, 55}, {143, 35, 133}, {183, 36, 168}, {224, 27, 204}, {258, 31, 231}}
 		}
 	},
 	{
@@ -1721,7 +1835,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			45, 340,
 			"SLPWKVLLVMLLALITLATTLSNAFVIATVYRTRKLHTPANYLIASLAVTDLLVSILVMPISTMYTVTGRWTLGQVVCDFWLSSDITCCTASILHLCVIALDRYWAITDAVEYSAKRTPKRAAVMIALVWVFSISISLPPFFW...........CVV...HILYTVYSTVGAFYFPTLLLIALYGRIYVEARSRILKQTP..........................................................KLMAARERKATKTLGIILGAFIVCWLPFFIISLVMPIC......HLAIFDFFTWLGYLNSLINPIIYTMSNEDFKQAFHKLI",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371}
+			{{0, 33, 22}, {33, 4, 262}, {37, 19, 55}, {56, 18, 266}, {74, 35, 98}, {109, 8, 284}, {117, 26, 138}, {154, 3, 292}, {160, 40, 295}, {258, 4, 335}, {262, 27, 204}, {289, 7, 339}, {302, 14, 346}, {316, 12, 237}, {328, 12, 360}}
 		}
 	},
 	{
@@ -1729,7 +1843,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			37, 284,
 			"VKQIGAQLLPPLYSLVFIFGFVGNMLVVLILINCKKLKCLTDIYLLNLAISDLLFLITLPLWAHSAANEWVFGNAMCKLFTGLYHIGYFGGIFFIILLTIDRYLAIVHAVFALKARTVTFGVVTSVITWLVAVFASVPGIIFT..........CGP..PRGWNNFHTIMRNILGLVLPLLIMVICYSGILKTLLRC...KKRHRAVRVIFTIMIVYFLFWTPYNIVILLNTFQEFFG....ESTSQLDQATQVTETLGMTHCCINPIIYAFVGEKFRSLFHIAL",
-			{21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, 409, -1, -1, -1, -1, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371}
+			{{0, 34, 21}, {34, 4, 262}, {38, 27, 55}, {65, 3, 372}, {68, 5, 279}, {73, 35, 98}, {108, 8, 284}, {116, 27, 375}, {153, 3, 292}, {158, 4, 402}, {162, 34, 295}, {199, 27, 204}, {226, 7, 339}, {233, 4, 406}, {241, 5, 410}, {246, 14, 346}, {260, 12, 237}, {272, 12, 360}}
 		}
 	},
 	{
@@ -1737,7 +1851,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			65, 288,
 			"MVTAITIMALYSIVCVVGLFGNFLVMYVIVRYTKMKTATNIYIFNLALADALATSTLPFQSVNYLMGTWPFGNILCKIVISIDYYNMFTSIFTLCTMSVDRYIAVCHPVKALDFRTPRNAKIVNVCNWILSSAIGLPVMFMA..........CTL....PTWYWENLLKICVFIFAFIMPVLIITVCYGLMILRLKSV.....SKEKDRNLRRITRMVLVVVAVFIVCWTPIHIYVIIKALI....TTFQTVSWHFCIALGYTNSCLNPVLYAFLDENFKRCFREFCI",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 416, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, -1, -1, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 32, 23}, {32, 4, 262}, {36, 27, 55}, {63, 3, 372}, {66, 1, 415}, {67, 5, 279}, {72, 35, 98}, {107, 8, 284}, {115, 27, 138}, {152, 3, 292}, {159, 1, 416}, {160, 4, 402}, {164, 34, 295}, {203, 1, 417}, {204, 4, 335}, {208, 27, 204}, {235, 7, 339}, {246, 3, 412}, {249, 14, 346}, {263, 12, 237}, {275, 12, 360}, {287, 1, 418}}
 		}
 	},
 	{
@@ -1745,7 +1859,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			130, 284,
 			"NTHEKVKTALNLFYLTIIGHGLSIASLLISLGIFFYFKSLSCQRITLHKNLFFSFVCNSVVTIIHLTAV...........VSCKVSQFIHLYLMGCNYFWMLCEGIYLHTLIVV.......HLMWYYFLGWGFPLIPACIHAIARSLY....CWI...THLLYIIHGPICAALLVNLFFLLNIVRVLITKLK.........YMKAVRATLILVPLLGIEFVLIPW....KIAEEVYDYIMHILMHFQGLLVSTIFCFFNGEVQAILRRNWNQYKIQFGNSFSNS",
-			{419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, -1, -1, -1, -1, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, 447, 448, 449, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, -1, -1, -1, -1, -1, -1, -1, -1, -1, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465}
+			{{0, 1, 419}, {1, 36, 19}, {37, 4, 262}, {41, 27, 55}, {68, 1, 372}, {80, 34, 99}, {121, 27, 420}, {152, 3, 292}, {158, 6, 447}, {164, 28, 171}, {201, 24, 206}, {229, 3, 412}, {232, 14, 346}, {246, 12, 237}, {258, 12, 360}, {270, 1, 418}, {271, 13, 453}}
 		}
 	},
 	{
@@ -1753,7 +1867,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			29, 291,
 			"SGPQKTAVAVLCTLLGLLSALENVAVLYLILSSHQLR.KPSYLFIGSLAGADFLASVVFACSFVNFHV.....SKAVFLLKIGSVTMTFTASVGSLLLTAIDRYLCLRYPPSYKALLTRGRALVTLGIMWVLSALVSYLPLMG...............PNDYLLSWLLFIAFLFSGIIYTYGHVLWKAHQHVASLSG............RLDVRLAKTLGLVLAVLLICWFPVLALMAHSLAT..SDQVKKAFAFCSMLCLINSMVNPVIYALRSGEIRSSAHHCLAHWKK",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, -1, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, -1, -1, -1, -1, -1, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 466, 467, 468, 469, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456}
+			{{0, 33, 22}, {33, 4, 262}, {38, 27, 55}, {65, 3, 372}, {73, 1, 283}, {74, 35, 98}, {109, 8, 284}, {117, 26, 138}, {158, 4, 466}, {162, 35, 168}, {209, 27, 204}, {236, 7, 339}, {245, 3, 412}, {248, 14, 346}, {262, 12, 237}, {274, 12, 360}, {286, 1, 418}, {287, 4, 453}}
 		}
 	},
 	{
@@ -1761,7 +1875,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			45, 288,
 			"EINKYFVVIIYALVFLLSLLGNSLVMLVILYSRVGRSVTDVYLLNLALADLLFALTLPIWAASKVNGWIFGTFLCKVVSLLKEVNFYSGILLLACISVDRYLAIVHATRTLTQKRYLVKFICLSIWGLSLLLALPVLLFR...........CYE....NTANWRMLLRILPQSFGFIVPLLIMLFCYGFTLRTLFKA...QKHRAMRVIFAVVLIFLLCWLPYNLVLLADTLMRTQ....TCERRNHIDRALDATEILGILHSCLNPLIYAFIGQKFRHGLLKILAIH",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 470, 471, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 416, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, -1, -1, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454}
+			{{0, 32, 23}, {32, 4, 262}, {36, 27, 55}, {63, 3, 372}, {66, 5, 279}, {71, 35, 98}, {106, 8, 284}, {114, 2, 470}, {116, 24, 378}, {151, 3, 292}, {158, 1, 416}, {159, 4, 402}, {163, 34, 295}, {200, 26, 205}, {226, 7, 339}, {233, 3, 406}, {240, 2, 472}, {242, 5, 410}, {247, 14, 346}, {261, 12, 237}, {273, 12, 360}, {285, 1, 418}, {286, 2, 453}}
 		}
 	},
 	{
@@ -1769,7 +1883,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			26, 295,
 			"KYPLYSMVFSIVFMVGLITNVAAMYIFMCSLKLRNETTTYMMNLVVSDLLFVLTLPLRVFYFVQ.NWPFGSLLCKLSVSLFYTNMYGSILFLTCISVDRFLAIVYPFRSRGLRTKRNAKIVCAAVWVLVLSGSLPTGFMLN...........CFE......WKSHLSKVVIFIETVGFLIPLMLNVVCSAMVLQTLRRP....RGGKLNKKKILRMIIVHLFIFCFCFIPYNVNLVFYSLVRTN...GCAAESVVRTIYPIALCIAVSNCCFDPIVYYFTSETIQNSIKRKTQTG",
-			{25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, -1, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454}
+			{{0, 30, 25}, {30, 4, 262}, {34, 27, 55}, {61, 3, 372}, {65, 5, 279}, {70, 35, 98}, {105, 8, 284}, {113, 28, 138}, {152, 3, 292}, {161, 4, 402}, {165, 34, 295}, {203, 4, 335}, {207, 27, 204}, {234, 7, 339}, {241, 3, 406}, {247, 2, 472}, {249, 5, 410}, {254, 14, 346}, {268, 12, 237}, {280, 12, 360}, {292, 1, 418}, {293, 2, 453}}
 		}
 	},
 	{
@@ -1777,7 +1891,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			35, 315,
 			"NEALARVEVAVLCLILLLALSGNACVLLALRTTRQKHSRLFFFMKHLSIADLVVAVFQVLPQLLWDIT.RFYGPDLLCRLVKYLQVVGMFASTYLLLLMSLDRCLAICQ.....RRRTDRLAVLATWLGCLVASAPQVHIF...........CWA.....WGPKAYITWITLAVYIVPVIVLAACYGLISFKIWQNLRLKTAAA.........................KLISKAKIRTVKMTFIIVLAFIVCWTPFFFVQMWSVW.....KEASAFIIVMLLASLNSCCNPWIYMLFTGHLFHELVQRFLCCSA",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, -1, -1, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, 475, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, -1, -1, -1, -1, -1, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456}
+			{{0, 33, 22}, {33, 4, 262}, {37, 19, 55}, {56, 12, 266}, {69, 5, 279}, {74, 35, 98}, {114, 27, 375}, {152, 3, 292}, {160, 2, 404}, {162, 40, 295}, {202, 2, 474}, {229, 4, 335}, {233, 27, 204}, {260, 6, 339}, {271, 1, 414}, {272, 14, 346}, {286, 12, 237}, {298, 12, 360}, {310, 1, 418}, {311, 4, 453}}
 		}
 	},
 	{
@@ -1785,7 +1899,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			11, 432,
 			"ATAAIAAAITFLILFTIFGNALVILAVLTSRSLRAPQNLFLVSLAAADILVATLIIPFSLANELLGYWYFRRTWCEVYLALDVLFCTSSIVHLCAISLDRYWAVSRALEYNSKRTPRRIKCIILTVWLIAAVISLPPLI..............CKL..EAWYILASSIGSFFAPCLIMILVYLRIYLIAKRSNRRGPRA......................................................................................................................................................RAQLTREKRFTFVLAVVIGVFVLCWFPFFFSYSLGAIC......PHGLFQFFFWIGYCNSSLNPVIYTIFNQDFRRAFRRILC",
-			{25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 30, 25}, {30, 4, 262}, {34, 19, 55}, {53, 18, 266}, {71, 35, 98}, {106, 8, 284}, {114, 25, 138}, {153, 3, 292}, {158, 40, 295}, {198, 1, 474}, {349, 4, 335}, {353, 27, 204}, {380, 7, 339}, {393, 14, 346}, {407, 12, 237}, {419, 12, 360}, {431, 1, 418}}
 		}
 	},
 	{
@@ -1793,7 +1907,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			71, 292,
 			"GKLTTVFLPIVYTIVFVVGLPSNGMALWVFLFR....HPAVIYMANLALADLLSVIWFPLKIAYHIH..NWIYGEALCNVLIGFFYGNMYCSILFMTCLSVQRYWVIVNPMGHSRKKANIAIGISLAIWLLILLVTIPLYV..............CHD......LVGDMFNYFLSLAIGVFLFPAFLTASAYVLMIRMLRSS...ENSEKKRKRAIKLIVTVLAMYLICFTPSNLLLVVHYFLIKSQ....VYALYIVALCLSTLNSCIDPFVYYFVSHDFRDHAKNALLCR",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, -1, -1, -1, -1, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, -1, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454}
+			{{0, 33, 22}, {37, 27, 55}, {64, 3, 372}, {69, 5, 279}, {74, 35, 98}, {109, 7, 284}, {116, 25, 375}, {155, 3, 292}, {164, 4, 402}, {168, 34, 295}, {205, 42, 476}, {251, 14, 346}, {265, 12, 237}, {277, 12, 360}, {289, 1, 418}, {290, 2, 453}}
 		}
 	},
 	{
@@ -1801,7 +1915,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			610, 266,
 			"EPFGIALTLFAVLGIFLTAFVLGVFIKF..TPIVKATNRELSYLLLFSLLCCFSSSLFFI...QDWTCRLRQPAFGISFVLCISCILVKTNRVLLVF.............GLNLQFLLVFLCTFMQIVICVIWLYTA..................CHE..LMALGFLIGYTCLLAAICFFFAFKSRKL....NEAKFITFSMLIFFIVWISFIPAYAST.GKFVSAVEVIAILAASFGLLACIFFNKIYIILFKPSRNTIEEVRCS",
-			{27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, -1, -1, 518, 262, 263, 264, 265, 519, 520, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, -1, -1, -1, 521, 522, 523, 524, 525, 526, 527, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, 467, 468, 469, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, -1, -1, -1, -1, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, -1, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370}
+			{{0, 28, 27}, {30, 1, 518}, {31, 4, 262}, {35, 2, 519}, {37, 23, 57}, {63, 7, 521}, {70, 27, 105}, {110, 27, 138}, {155, 3, 292}, {160, 3, 467}, {163, 25, 168}, {192, 23, 208}, {215, 4, 339}, {220, 35, 528}, {255, 11, 360}}
 		}
 	},
 	{
@@ -1809,7 +1923,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			39, 297,
 			"GARSASSLALAIAITALYSAVCAVGLLGNVLVMFGIVRYTKMKTATNIYIFNLALADALATSTLPFQSAKYLMETWPFGELLCKAVLSIDYYNMFTSIFTLTMMSVDRYIAVCHPVKALDFRTPAKAKLINICIWVLASGVGVPIMVMA..........CML....PSWYWDTVTKICVFLFAFVVPILIITVCYGLMLLRLRSV.....SKEKDRSLRRITRMVLVVVGAFVVCWAPIHIFVIVWTLV.....DPLVVAALHLCIALGYANSSLNPVLYAFLDENFKRCFRQLCRK",
-			{563, 564, 419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 416, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, -1, -1, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453}
+			{{0, 2, 563}, {2, 1, 419}, {3, 36, 19}, {39, 4, 262}, {43, 27, 55}, {70, 3, 372}, {73, 1, 415}, {74, 5, 279}, {79, 35, 98}, {114, 8, 284}, {122, 27, 138}, {159, 3, 292}, {166, 1, 416}, {167, 4, 402}, {171, 34, 295}, {210, 1, 417}, {211, 4, 335}, {215, 27, 204}, {242, 7, 339}, {254, 3, 412}, {257, 14, 346}, {271, 12, 237}, {283, 12, 360}, {295, 1, 418}, {296, 1, 453}}
 		}
 	},
 	{
@@ -1817,7 +1931,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			52, 318,
 			"VAFPITMLLTGFVGNALAMLLVSRSYR......KKSFLLCIGWLALTDLVGQLLTTPVVIVVYLSK.RWEH....GRLCTFFGLTMTVFGLSSLFIASAMAVERALAIRAPHWYASHMKTRATRAVLLGVWLAVLAFALLPVLG............CFI..............WGNLFFASAFAFLGLLALTVTFSCNLATIKALVSRCRAKA....SSAQWGRITTETAIQLMGIMCVLSVCWSPLLIMMLKMIFNQTS.....THTEKQKECNFFLIAVRLASLNQILDPWVYLLLRKILLRKFCQIRYHTNNYAS",
-			{30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 565, 566, -1, -1, -1, -1, -1, -1, 567, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, -1, 279, 280, 281, 282, -1, -1, -1, -1, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 568, 569, 466, 467, 468, 469, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, -1, -1, -1, -1, 570, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, -1, -1, -1, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 571, 572, 562, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459}
+			{{0, 25, 30}, {25, 2, 565}, {33, 1, 567}, {34, 19, 55}, {53, 13, 266}, {67, 4, 279}, {75, 35, 98}, {110, 8, 284}, {118, 26, 138}, {156, 3, 292}, {173, 2, 568}, {175, 4, 466}, {179, 34, 168}, {217, 1, 570}, {218, 1, 417}, {219, 4, 335}, {223, 27, 204}, {250, 7, 339}, {257, 3, 406}, {265, 2, 472}, {267, 5, 410}, {272, 14, 346}, {286, 9, 237}, {295, 2, 571}, {297, 1, 562}, {298, 12, 360}, {310, 1, 418}, {311, 7, 453}}
 		}
 	},
 	{
@@ -1825,7 +1939,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			578, 263,
 			"PEPIAAVVFACLGLLATLFVTVVFIIY..TPVVKSSSRELCYIILAGICLGYLCTFCLI...KQIYCYLQRIGIGLSPAMSYSALVTKTNRIARIL...............SACAQLVIAFILICIQLGIIVALFIME.................CNTTNLGVVTPLGYNGLLILSCTFYAFKT........EAKYIAFTMYTTCIIWLAFVPIYFGS.YKIITMCFSVSLSATVALGCMFVPKVYIILAKPERNVRSAFTTS",
-			{28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, -1, -1, 518, 262, 263, 264, 265, 519, 520, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, -1, -1, -1, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, 466, 467, 468, 469, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, -1, -1, -1, -1, -1, -1, -1, -1, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, -1, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370}
+			{{0, 27, 28}, {29, 1, 518}, {30, 4, 262}, {34, 2, 519}, {36, 23, 57}, {62, 1, 283}, {63, 33, 98}, {111, 27, 138}, {155, 3, 292}, {158, 4, 466}, {162, 22, 168}, {192, 22, 209}, {214, 4, 339}, {219, 33, 530}, {252, 11, 360}}
 		}
 	},
 	{
@@ -1833,7 +1947,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			59, 325,
 			"DIYSKVLVTAVYLALFVVGTVGNTVTAFTLARK....SLQSTVHYHLGSLALSDLLTLLLAMPVELYNFIWV..PWAFGDAGCRGYYFLRDACTYATALNVASLSVERYLAICHPFKAKTLMSRSRTKKFISAIWLASALLAVPMLFTM................CTP..HTATVKVVIQVNTFMSFIFPMVVISVLNTIIANKLTVMVRQAAEQG.................PGRVQALRHGVRVLRAVVIAFVVCWLPYHVRRLMFCYI.....TPFLYDFYHYFYMVTNALFYVSSTINPILYNLVSANFRHIFLATLACLC",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, -1, -1, -1, -1, 573, 574, 567, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, -1, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, 475, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455}
+			{{0, 33, 22}, {37, 2, 573}, {39, 1, 567}, {40, 19, 55}, {59, 13, 266}, {74, 5, 279}, {79, 35, 98}, {114, 8, 284}, {122, 27, 375}, {165, 3, 292}, {170, 4, 402}, {174, 40, 295}, {214, 2, 474}, {233, 4, 335}, {237, 27, 204}, {264, 7, 339}, {276, 2, 472}, {278, 5, 410}, {283, 14, 346}, {297, 12, 237}, {309, 12, 360}, {321, 1, 418}, {322, 3, 453}}
 		}
 	},
 	{
@@ -1841,7 +1955,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			33, 290,
 			"EPWQFSMLAAYMFLLIMLGFPINFLTLYVTVQHKKLRTPLNYILLNLAVADLFMVFGGFTTTLYTSLHGYFVFGPTGCNLEGFFATLGGEIALWSLVVLAIERYVVVCKPMSNFRFGENHAIMGVAFTWVMALACAAPPLV.............CGI.........NNESFVIYMFVVHFIIPLIVIFFCYGQLVFTVKEAAAQQ..SATTQKAEKEVTRMVIIMVIAFLICWLPYAGVAFYIFTH.....GPIFMTIPAFFAKTSAVYNPVIYIMMNKQFRNCMVTTLC",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, -1, -1, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, -1, -1, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 33, 22}, {33, 4, 262}, {37, 19, 55}, {56, 18, 266}, {74, 35, 98}, {109, 7, 284}, {116, 25, 138}, {154, 3, 292}, {166, 1, 405}, {167, 38, 295}, {207, 1, 417}, {208, 4, 335}, {212, 27, 204}, {239, 7, 339}, {251, 14, 346}, {265, 12, 237}, {277, 12, 360}, {289, 1, 418}}
 		}
 	},
 	{
@@ -1849,7 +1963,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			31, 412,
 			"RPHYNYYATLLTLLIAVIVFGNVLVCMAVSREKALQTTTNYLIVSLAVADLLVATLVMPWVVYLEVVGEWKFSRIHCDIFVTLDVMMCTASILNLCAISIDRYTAVAMPMLYNTRYSSKRRVTVMISIVWVLSFTISCPLLFG........CII.NPAFVVYSSIVSFYVPFIVTLLVYIKIYIVLRRRRKRVNTK.......................................................................................................................................KLSQQKEKKATQMLAIVLGVFIICWLPFFITHILNIHC....PPVLYSAFTWLGYVNSAVNPIIYTTFNIEFRKAFLKILH",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 575, 576, 577, 578, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 32, 23}, {32, 4, 262}, {36, 19, 55}, {55, 18, 266}, {73, 35, 98}, {108, 5, 284}, {113, 4, 575}, {117, 26, 375}, {151, 3, 292}, {155, 40, 295}, {195, 1, 474}, {331, 4, 335}, {335, 27, 204}, {362, 7, 339}, {373, 14, 346}, {387, 12, 237}, {399, 12, 360}, {411, 1, 418}}
 		}
 	},
 	{
@@ -1857,7 +1971,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			173, 316,
 			"FLTNETREREVFDRLGMIYTVGYSVSLASLTVAVLILAYFRRLHCTRNYIHMHLFLSFMLRAVSIFVKDAVLYSGAT...........................GYAGCRVAVTFFLYFLATNYYWILVEGLYLHSLIFM...SEKKYLWGFTVFGWGLPAVFVAVWVSVRATLA...CWD...GNKKWIIQVPILASIVLNFILFINIVRVLATKL........DTRQQYRKLLKSTLVLMPLFGVHYIVFMAT......GTLWQVQMHYEMLFNSFQGFFVAIIYCFCNGEVQAEIKKSWSRWTLALDFKRKAR",
-			{579, 563, 564, 419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, 580, 581, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, 582, 583, 584, 585, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 586, -1, -1, -1, 292, 293, 294, -1, -1, -1, 447, 448, 449, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, -1, -1, -1, -1, -1, -1, -1, -1, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, -1, -1, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465}
+			{{0, 1, 579}, {1, 2, 563}, {3, 1, 419}, {4, 36, 19}, {40, 4, 262}, {44, 27, 55}, {71, 3, 372}, {74, 1, 415}, {75, 2, 580}, {104, 1, 283}, {105, 35, 98}, {143, 4, 582}, {147, 27, 420}, {174, 1, 586}, {178, 3, 292}, {184, 6, 447}, {190, 27, 171}, {225, 3, 336}, {228, 27, 204}, {261, 3, 412}, {264, 14, 346}, {278, 12, 237}, {290, 12, 360}, {302, 1, 418}, {303, 13, 453}}
 		}
 	},
 	{
@@ -1865,7 +1979,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			26, 316,
 			"QERDEVWVVGMGIVMSLIVLAIVFGNVLVITAIAKFERLQTVTNYFITSLACADLVMGLAVVPFGAAHILMKMWTFGNFWCEFWTSIDVLCVTASIETLCVIAVDRYFAITSPFKYQSLLTKNKARVIILMVWIVSGLTSFLPIQMH..................CDF..NQAYAIASSIVSFYVPLVIMVFVYSRVFQEAKRQLQKIDKSE........................SKFCLKEHKALKTLGIIMGTFTLCWLPFFIVNIVHVIQ....RKEVYILLNWIGYVNSGFNPLIYCRSPDFRIAFQELLC",
-			{19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, 475, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 36, 19}, {36, 4, 262}, {40, 19, 55}, {59, 18, 266}, {77, 35, 98}, {112, 8, 284}, {120, 27, 138}, {165, 3, 292}, {170, 40, 295}, {210, 2, 474}, {236, 4, 335}, {240, 27, 204}, {267, 7, 339}, {278, 14, 346}, {292, 11, 237}, {303, 12, 360}, {315, 1, 418}}
 		}
 	},
 	{
@@ -1873,7 +1987,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			1, 314,
 			"MPIMGSSVYITVELAIAVLAILGNVLVCWAVWLNSNLQNVTNYFVVSLAAADIAVGVLAIPFAITISTGFCAACHGCLFIACFVLVLTQSSIFSLLAIAIDRYIAIRIPLRYNGLVTGTRAKGIIAICWVLSFAIGLTPMLG.......................CLF....PMNYMVYFNFFACVLVPLLLMLGVYLRIFLAARRQLKQMES.....ERARSTLQKEVHAAKSLAIIVGLFALCWLPLHIINCFTFFC......PLWLMYLAIVLSHTNSVVNPFIYAYRIREFRQTFRKIIRSHVLRQQEPF",
-			{21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 587, 588, 589, 590, 591, 592, 593, 594, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, -1, -1, -1, -1, -1, 595, 570, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462}
+			{{0, 34, 21}, {34, 4, 262}, {38, 19, 55}, {57, 12, 266}, {69, 4, 280}, {73, 35, 98}, {108, 8, 284}, {116, 26, 138}, {165, 3, 292}, {172, 8, 587}, {180, 33, 302}, {218, 1, 595}, {219, 1, 570}, {220, 1, 417}, {221, 4, 335}, {225, 27, 204}, {252, 7, 339}, {265, 14, 346}, {279, 12, 237}, {291, 12, 360}, {303, 1, 418}, {304, 10, 453}}
 		}
 	},
 	{
@@ -1881,7 +1995,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			21, 326,
 			"SVRILTACFLSLLILSTLLGNTLVCAAVIRFRHLRSKVTNFFVISLAVSDLLVAVLVMPWKAVAEIAGFWPFGSFCNIWVAFDIMCSTASILNLCVISVDRYWAISSPFRYERKMTPKAAFILISVAWTLSVLISFIPVQLS.......................CDS..SRTYAISSSVISFYIPVAIMIVTYTRIYRIAQKQIRRIAALERAAVHAKNCQ..................KMSFKRETKVLKTLSVIMGVFVCCWLPFFILNCILPFC..........DSNTFDVFVWFGWANSSLNPIIYAFNADFRKAFSTLLG",
-			{24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 519, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, 475, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 31, 24}, {31, 4, 262}, {35, 1, 519}, {36, 19, 55}, {55, 17, 266}, {72, 35, 98}, {107, 8, 284}, {115, 27, 138}, {165, 3, 292}, {170, 40, 295}, {210, 2, 474}, {212, 10, 596}, {240, 4, 335}, {244, 27, 204}, {271, 7, 339}, {288, 14, 346}, {302, 11, 237}, {313, 12, 360}, {325, 1, 418}}
 		}
 	},
 	{
@@ -1889,7 +2003,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			69, 329,
 			"LHLQEKNWSALLTAVVIILTIAGNILVIMAVSLEKKLQNATNYFLMSLAIADMLLGFLVMPVSMLTILYG.RWPLPSKLCAVWIYLDVLFSTASIMHLCAISLDRYVAIQNPIHHSRFNSRTKAFLKIIAVWTISVGISMPIPVFGLQD.........CLL.DDNFVLIGSFVSFFIPLTIMVITYFLTIKSLQKEATLCVSDL.......................................MQSISNEQKACKVLGIVFFLFVVMWCPFFITNIMAVIC....NEDVIGALLNVFVWIGYLSSAVNPLVYTLFNKTYRSAFSRYIQC",
-			{21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 606, 607, 608, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, 475, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453}
+			{{0, 34, 21}, {34, 4, 262}, {38, 19, 55}, {57, 13, 266}, {71, 5, 279}, {76, 35, 98}, {111, 8, 284}, {119, 27, 375}, {146, 3, 606}, {158, 3, 292}, {162, 40, 295}, {202, 2, 474}, {243, 4, 335}, {247, 27, 204}, {274, 7, 339}, {285, 4, 411}, {289, 14, 346}, {303, 12, 237}, {315, 12, 360}, {327, 1, 418}, {328, 1, 453}}
 		}
 	},
 	{
@@ -1897,7 +2011,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			7, 306,
 			"CENWLALENILKKYYLSAFYGIEFIVGMLGNFTVVFGYLFCM...NSSNVYLFNLSISDLAFLCTLPMLIRSYATGNWTYGDVLCISNRYVLHANLYTSILFLTFISIDRYLLMKFPFREHILQKKEFAILISLAVWVLVTLEVLPMLTFITST.......CVD.....NPKYSLIYSLCLTLLGFLIPLSVMCFFYYKMVVFLKKR...QATVLSLNKPLRLVVLAVVIFSVLFTPYHIMRNVRIASRL......CSQKAIKCLYILTRPLAFLNSAVNPIFYFLVGDHFRDMLFSKLRQYFKSL",
-			{609, 579, 563, 564, 419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 565, -1, -1, -1, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 606, 607, 608, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, -1, -1, -1, -1, -1, -1, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458}
+			{{0, 1, 609}, {1, 1, 579}, {2, 2, 563}, {4, 1, 419}, {5, 36, 19}, {41, 1, 565}, {45, 27, 55}, {72, 3, 372}, {75, 1, 415}, {76, 5, 279}, {81, 35, 98}, {116, 8, 284}, {124, 27, 375}, {151, 3, 606}, {161, 3, 292}, {169, 4, 402}, {173, 34, 295}, {210, 4, 335}, {214, 27, 204}, {241, 7, 339}, {248, 2, 406}, {256, 5, 410}, {261, 14, 346}, {275, 12, 237}, {287, 12, 360}, {299, 1, 418}, {300, 6, 453}}
 		}
 	},
 	{
@@ -1905,7 +2019,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			19, 438,
 			"KTFEVVFIVLVAGSLSLVTIIGNILVMVSIKVNRHLQTVNNYFLFSLACADLIIGVFSMNLYTLYTVIGYWPLGPVVCDLWLALDYVVSNASVMNLLIISFDRYFCVTKPLTYPVKRTTKMAGMMIAAAWVLSFILWAPAILFWQFIVG........CYI....NAAVTFGTAIAAFYLPVIIMTVLYWHISRASKSRIKKDKKE........................................................................................................................................................KPPPSREKKVTRTILAILLAFIITWAPYNVMVLINTFC....PNTVWTIGYWLCYINSTINPACYALCNATFKKTFKHLLM",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 610, 611, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 33, 22}, {33, 4, 262}, {37, 19, 55}, {56, 18, 266}, {74, 35, 98}, {109, 8, 284}, {117, 30, 138}, {147, 2, 610}, {157, 3, 292}, {164, 40, 295}, {204, 1, 474}, {357, 4, 335}, {361, 27, 204}, {388, 7, 339}, {399, 14, 346}, {413, 12, 237}, {425, 12, 360}, {437, 1, 418}}
 		}
 	},
 	{
@@ -1913,7 +2027,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			39, 297,
 			"QEVRQFSRLFVPIAYSLICVFGLLGNILVVITFAFYKKARSMTDVYLLNMAIADILFVLTLPFWAVSHATGAWVFSNATCKLLKGIYAINFNCGMLLLTCISMDRYIAIVQATKSFRL...TLPRSKIICLVVWGLSVIISSSTFVFN..........CEP.......PIRWKLLMLGLELLFGFFIPLMFMIFCYTFIVKTLVQA..SKRHKAIRVIIAVVLVFLACQIPHNMVLLVTAANLGKM..SCQSEKLIGYTKTVTEVLAFLHCCLNPVLYAFIGQKFRNYFLKILKDLW",
-			{19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, -1, -1, -1, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, 409, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455}
+			{{0, 36, 19}, {36, 4, 262}, {40, 27, 55}, {67, 3, 372}, {70, 1, 415}, {71, 5, 279}, {76, 35, 98}, {111, 7, 284}, {121, 27, 375}, {158, 3, 292}, {168, 4, 402}, {172, 34, 295}, {208, 27, 204}, {235, 7, 339}, {242, 4, 406}, {248, 2, 472}, {250, 5, 410}, {255, 14, 346}, {269, 12, 237}, {281, 12, 360}, {293, 1, 418}, {294, 3, 453}}
 		}
 	},
 	{
@@ -1921,7 +2035,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			112, 302,
 			"NPSQQLAIAVLSLTLGTFTVLENLLVLCVILHSRSLR.RPSYHFIGSLAVADLLGSVIFVYSFIDFHV.....SRNVFLFKLGGVTASFTASVGSLFLTAIDRYISIHRPLAYKRIVTRPKAVVAFCLMWTIAIVIAVLPLLG.................DETYLMFWIGVTSVLLLFIVYAYMYILWKAHSHAVRMIQRG...................PDQARMDIRLAKTLVLILVVLIICWGPLLAIMVYDVFG..NKLIKTVFAFCSMLCLLNSTVNPIIYALRSKDLRHAFRSMFP",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, -1, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, -1, -1, -1, -1, -1, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 466, 467, 468, 469, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 612, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 33, 22}, {33, 4, 262}, {38, 27, 55}, {65, 3, 372}, {73, 1, 283}, {74, 35, 98}, {109, 8, 284}, {117, 26, 138}, {160, 4, 466}, {164, 36, 168}, {200, 1, 612}, {220, 4, 335}, {224, 27, 204}, {251, 7, 339}, {260, 3, 412}, {263, 14, 346}, {277, 12, 237}, {289, 12, 360}, {301, 1, 418}}
 		}
 	},
 	{
@@ -1929,7 +2043,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			34, 275,
 			"RVPDILALVIFAVVFLVGVLGNALVVWVTAFE...TINAIWFLNLAVADFLSCLALPILFTSIVQH.HWPFGGAACSILPSLILLNMYASILLLATISADRFLLVFKPIWCQNFRGAGLAWIACAVAWGLALLLTIPSFLYR............CGV....DKRRERAVAIVRLVLGFLWPLLTLTICYTFILLRTWSR.....TKTLKVVVAVVASFFIFWLPYQVTGIMMSFL...SPTFLLLKKLDSLCVSFAYINCCINPIIYVVAGQGFQ",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, -1, -1, -1, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, -1, -1, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253}
+			{{0, 32, 23}, {35, 27, 55}, {62, 3, 372}, {65, 1, 415}, {67, 5, 279}, {72, 35, 98}, {107, 8, 284}, {115, 27, 375}, {154, 3, 292}, {161, 4, 402}, {165, 34, 295}, {204, 24, 207}, {228, 7, 339}, {238, 1, 473}, {239, 5, 410}, {244, 14, 346}, {258, 17, 237}}
 		}
 	},
 	{
@@ -1937,7 +2051,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			63, 498,
 			"TIWQVVFIAFLTGFLALVTIIGNILVIVAFKVNKQLKTVNNYFLLSLACADLIIGVISMNLFTTYIIM.RWALGNLACDLWLSIDYVASNASVMNLLVISFDRYFSITRPLTYRAKRTTKRAGVMIGLAWVISFVLWAPAILFWQYFVG........CFI....EPTITFGTAIAAFYMPVTIMTILYWRIYKETEKRTKELAGL...................................................................................................................................................................................................................RMSLIKEKKAAQTLSAILLAFIITWTPYNIMVLVNTFC....PKTYWNLGYWLCYINSTVNPVCYALCNKTFRTTFKTLLLC",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 610, 611, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453}
+			{{0, 33, 22}, {33, 4, 262}, {37, 19, 55}, {56, 12, 266}, {69, 5, 279}, {74, 35, 98}, {109, 8, 284}, {117, 30, 138}, {147, 2, 610}, {157, 3, 292}, {164, 40, 295}, {204, 1, 474}, {416, 4, 335}, {420, 27, 204}, {447, 7, 339}, {458, 14, 346}, {472, 12, 237}, {484, 12, 360}, {496, 1, 418}, {497, 1, 453}}
 		}
 	},
 	{
@@ -1945,7 +2059,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			100, 289,
 			"PILDDKQRKYDLHYRIALVVNYLGHCVSVAALVAAFLLFLALRSIRCLRNVIHWNLITTFILRNVMWFLLQLV........EVWCRCITTIFNYFVVTNFFWMFVEGCYLHTAIVM.......RKCLFLFIGWCIPFPIIVAWAIGKLYYE...CWF.......VDYIYQGPIILVLLINFVFLFNIVRILMTKLRA...SETIQYRKAVKATLVLLPLLGITYMLFFV.....DLSQIMFIYFNSFLQSFQGFFVSVFYCFFNGEVRSAVRKRWHRWQDHHSLRVPMA",
-			{613, 609, 579, 563, 564, 419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, -1, -1, -1, -1, -1, -1, -1, -1, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, -1, -1, -1, -1, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 586, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, 449, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, -1, -1, -1, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, -1, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465}
+			{{0, 1, 613}, {1, 1, 609}, {2, 1, 579}, {3, 2, 563}, {5, 1, 419}, {6, 36, 19}, {42, 4, 262}, {46, 27, 55}, {81, 35, 98}, {123, 27, 420}, {150, 1, 586}, {154, 3, 292}, {164, 4, 449}, {168, 29, 171}, {200, 3, 336}, {203, 26, 204}, {234, 3, 412}, {237, 14, 346}, {251, 12, 237}, {263, 12, 360}, {275, 1, 418}, {276, 13, 453}}
 		}
 	},
 	{
@@ -1953,7 +2067,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			103, 290,
 			"QEILNEEKKSKVHYHVAVIINYLGHCISLVALLVAFVLFLRLRSIRCLRNIIHWNLISAFILRNATWFVVQLT.........VGWCRLVTAAYNYFHVTNFFWMFGEGCYLHTAIVL......LRKWMFICIGWGVPFPIIVAWAIGKLYYD...CWF.......TDYIYQGPMILVLLINFIFLFNIVRILMTKL.....SETIQYRKAVKATLVLLPLLGITYMLFFV.....EVSRVVFIYFNSFLESFQGFFVSVFYCFLNSEVRSAIRKRWHRWQDKHSIRARVA",
-			{613, 609, 579, 563, 564, 419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, -1, -1, -1, -1, -1, -1, -1, -1, -1, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, -1, -1, -1, 585, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 586, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, 449, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, -1, -1, -1, -1, -1, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, -1, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465}
+			{{0, 1, 613}, {1, 1, 609}, {2, 1, 579}, {3, 2, 563}, {5, 1, 419}, {6, 36, 19}, {42, 4, 262}, {46, 27, 55}, {82, 35, 98}, {123, 1, 585}, {124, 27, 420}, {151, 1, 586}, {155, 3, 292}, {165, 4, 449}, {169, 27, 171}, {201, 3, 336}, {204, 26, 204}, {235, 3, 412}, {238, 14, 346}, {252, 12, 237}, {264, 12, 360}, {276, 1, 418}, {277, 13, 453}}
 		}
 	},
 	{
@@ -1961,7 +2075,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			30, 289,
 			"REENANFNKIFLPTIYSIIFLTGIVGNGLVILVMGYQKKLRSMTDKYRLHLSVADLLFVITLPFWAVDAVANWYFGNFLCKAVHVIYTVNLYSSVLILAFISLDRYLAIVHATNSQRPRKLLAEKVVYVGVWIPALLLTIPDFIFA..........CDR....DLWVVVFQFQHIMVGLILPGIVILSCYCIIISKLSHS....KRKALKTTVILILAFFACWLPYYIGISIDSFILLE....GCEFENTVHKWISITEALAFFHCCLNPILYAFLGAKFKTSAQHALT",
-			{419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, -1, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, -1, -1, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 1, 419}, {1, 36, 19}, {37, 4, 262}, {41, 27, 55}, {68, 3, 372}, {71, 5, 279}, {76, 35, 98}, {111, 8, 284}, {119, 27, 375}, {156, 3, 292}, {163, 3, 403}, {166, 34, 295}, {204, 25, 206}, {229, 7, 339}, {236, 3, 406}, {243, 2, 472}, {245, 5, 410}, {250, 14, 346}, {264, 12, 237}, {276, 12, 360}, {288, 1, 418}}
 		}
 	},
 	{
@@ -1969,7 +2083,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			49, 292,
 			"FQFYYLPAVYILVFIIGFLGNSVAIWMFVFH....SGISVYMFNLALADFLYVLTLPALIFYYFN..DWIFGDAMCKLQRFIFHVNLYGSILFLTCISAHRYSGVVYPLKSLGRLKKKNAICISVLVWLIVVVAISPILFYS...........CYD......LRSYFIYSMCTTVAMFCVPLVLILGCYGLIVRALIYK.....PLRRKSIYLVIIVLTVFAVSYIPFHVMKTMNLRARLD.....MCAFNDRVYATYQVTRGLASLNSCVDPILYFLAGDTFRRRLSRATR",
-			{24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, -1, -1, -1, -1, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, -1, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, -1, -1, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, -1, -1, -1, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 31, 24}, {35, 27, 55}, {62, 3, 372}, {67, 5, 279}, {72, 35, 98}, {107, 8, 284}, {115, 27, 138}, {153, 3, 292}, {162, 3, 403}, {165, 34, 295}, {204, 37, 480}, {246, 2, 472}, {248, 5, 410}, {253, 14, 346}, {267, 12, 237}, {279, 12, 360}, {291, 1, 418}}
 		}
 	},
 	{
@@ -1977,7 +2091,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			33, 326,
 			"AELLSQQWEAGMSLLMALVVLLIVAGNVLVIAAIGRTQRLQTLTNLFITSLACADLVMGLLVVPFGATLVVRGTWLWGSFLCECWTSLDVLCVTASIETLCVIAIDRYLAITSPFRYQSLMTRARAKVIICTVWAISALVSFLPIMMH..................CDF..NRAYAIASSIISFYIPLLIMIFVYLRVYREAKEQIRKIDRCE.............................RKTSRVMAMREHKALKTLGIIMGVFTLCWLPFFLVNIVNVFN....PDWLFVFFNWLGYANSAFNPIIYCRSPDFRKAFKRLLC",
-			{419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, 475, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 614, 595, 570, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 1, 419}, {1, 36, 19}, {37, 4, 262}, {41, 19, 55}, {60, 18, 266}, {78, 35, 98}, {113, 8, 284}, {121, 27, 138}, {166, 3, 292}, {171, 40, 295}, {211, 2, 474}, {242, 1, 614}, {243, 1, 595}, {244, 1, 570}, {245, 1, 417}, {246, 4, 335}, {250, 27, 204}, {277, 7, 339}, {288, 14, 346}, {302, 11, 237}, {313, 12, 360}, {325, 1, 418}}
 		}
 	},
 	{
@@ -1985,7 +2099,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			23, 293,
 			"PSWLASALACVLIFTIVVDILGNLLVILSVYRNKKLRNAGNIFVVSLAVADLVVAIYPYPLVLMSIFNNGWNLGYLHCQVSGFLMGLSVIGSIFNITGIAINRYCYICHSLKYDKLYSSKNSLCYVLLIWLLTLAAVLPNLRAG..........CTF....SSAYTIAVVVFHFLVPMIIVIFCYLRIWILVLQVRQRV.....PKLKPQDFRNFVTMFVVFVLFAICWAPLNFIGLAVASD........PEWLFVASYYMAYFNSCLNAIIYGLLNQNFRKEYRRIIVSLCT",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456}
+			{{0, 33, 22}, {33, 4, 262}, {37, 19, 55}, {56, 18, 266}, {74, 35, 98}, {109, 8, 284}, {117, 27, 375}, {154, 3, 292}, {161, 38, 295}, {204, 4, 335}, {208, 27, 204}, {235, 7, 339}, {250, 14, 346}, {264, 12, 237}, {276, 12, 360}, {288, 1, 418}, {289, 4, 453}}
 		}
 	},
 	{
@@ -1993,7 +2107,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			53, 332,
 			"YEWVLIAGYIIVFVVALIGNVLVCVAVWKNHHMRTVTNYFIVNLSLADVLVTITCLPATLVVDITETWFFGQSLCKVIPYLQTVSVSVSVLTLSCIALDRWYAICHPLMF..TAKRARNSIVIIWIVSCIIMIPQAIVM..................CDE.....IYPKMYHICFFLVTYMAPLCLMVLAYLQIFRKLWCRQIP................................VAAEIKQIRARRKTARMLMIVLLVFAICYLPISILNVLKRVF.......DRETVYAWFTFSHWLVYANSAANPIIYNFLSGKFREEFKAAFSCCCL",
-			{25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, -1, -1, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 614, 595, 570, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, -1, -1, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456}
+			{{0, 30, 25}, {30, 4, 262}, {34, 19, 55}, {53, 18, 266}, {71, 35, 98}, {106, 4, 284}, {112, 27, 375}, {157, 3, 292}, {165, 2, 404}, {167, 37, 295}, {236, 1, 614}, {237, 1, 595}, {238, 1, 570}, {239, 1, 417}, {240, 4, 335}, {244, 27, 204}, {271, 7, 339}, {285, 4, 411}, {289, 14, 346}, {303, 12, 237}, {315, 12, 360}, {327, 1, 418}, {328, 4, 453}}
 		}
 	},
 	{
@@ -2001,7 +2115,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			55, 288,
 			"NFKAWFLPIMYSIICFVGLLGNGLVVLTYIYFKRLKTMTDTYLLNLAVADILFLLTLPFWAYSAAKSWVFGVHFCKLIFAIYKMSFFSGMLLLLCISIDRYVAIVQAVSAHRHRA.VLLISKLSCVGIWILATVLSIPELLYS............CSL.....EAFITIQVAQMVIGFLVPLLAMSFCYLVIIRTLLQA..FERNKAIKVIIAVVVVFIVFQLPYNGVVLAQTVANFNI...TCELSKQLNIAYDVTYSLACVRCCVNPFLYAFIGVKFRNDLFKLFK",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 470, -1, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, 409, -1, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 32, 23}, {32, 4, 262}, {36, 27, 55}, {63, 3, 372}, {66, 5, 279}, {71, 35, 98}, {106, 8, 284}, {114, 1, 470}, {116, 27, 375}, {155, 3, 292}, {163, 2, 404}, {165, 34, 295}, {201, 27, 204}, {228, 7, 339}, {235, 4, 406}, {242, 2, 472}, {244, 5, 410}, {249, 14, 346}, {263, 12, 237}, {275, 12, 360}, {287, 1, 418}}
 		}
 	},
 	{
@@ -2009,7 +2123,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			31, 292,
 			"CTIENFKREFFPIVYLIIFFWGVLGNGLSIYVFLQP....TSVNVFMLNLAISDLLFISTLPFRADYYLRG.NWIFGDLACRIMSYSLYVNMYSSIYFLTVLSVVRFLAMVHPFRLLHVTSIRSAWILCGIIWILIMASSIMLLDS..........CLE.....IAKLQTMNYIALVVGCLLPFFTLSICYLLIIRVLLKV....SGLRVSHRKALTTIIITLIIFFLCFLPYHTLRTVHLTTW.....KDRLHKALVITLALAAANACFNPLLYYFAGENFKDRLKSALRK",
-			{19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, -1, -1, -1, -1, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, -1, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, -1, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453}
+			{{0, 36, 19}, {40, 27, 55}, {67, 3, 372}, {70, 1, 415}, {72, 5, 279}, {77, 35, 98}, {112, 8, 284}, {120, 26, 375}, {156, 3, 292}, {164, 3, 403}, {167, 34, 295}, {205, 39, 476}, {249, 3, 412}, {252, 14, 346}, {266, 12, 237}, {278, 12, 360}, {290, 1, 418}, {291, 1, 453}}
 		}
 	},
 	{
@@ -2017,7 +2131,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			263, 263,
 			"STVHILTRISQAGCGVSMIFLAFTIILYAFLRLSRERFK.EDAPKIHVALGGSLFLLNLAFLVNVGS....SDAACWARGAVFHYFLLCAFTWMGLEAFHLYLLAVR.......HYFLKLSLVGWGLPALMVIGTGSAN..................CWF......YALYITVHGYFLITFLFGMVVLALVVWKIFTLSRAT......KNRKKVLTLLGLSSLVGVTWGLAIF......TVYIFALFNSLQGVFICCWFTILY",
-			{24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 565, 566, 615, 616, 262, 263, 264, 265, -1, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, -1, -1, -1, -1, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, -1, -1, -1, -1, 585, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, 447, 448, 449, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, -1, -1, -1, -1, -1, -1, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, -1, -1, -1, -1, -1, -1, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249}
+			{{0, 31, 24}, {31, 2, 565}, {33, 2, 615}, {35, 4, 262}, {40, 27, 55}, {71, 1, 283}, {72, 35, 98}, {114, 1, 585}, {115, 24, 420}, {157, 3, 292}, {166, 6, 447}, {172, 30, 171}, {208, 25, 205}, {239, 11, 349}, {250, 13, 237}}
 		}
 	},
 	{
@@ -2025,7 +2139,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			223, 331,
 			"TEAEHQDMHSYIAAFGAVTGLCTLFTLATFVADWRNSNRYPAVILFYVNACFFVGSIGWLAQF..........................LSCVIIFVIVYYALMAGVVWFVVLTYAWHTSFKA..........KTSYFHLLTWSLPFVLTVAILAVA..........CFV...NYRYRAGFVLAPIGLVLIVGGYFLIRGVMTLFSIKSNH....SEKAASKINETMLRLGIFGFLAFGFVLITFSCHFYDFFNQAEWERSFRDYVLCQANVTI.................SLLVEKINLFAMFGTGIAMSTWVWTKATLLIWRRTWCRLT",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 518, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, 617, 618, 447, 448, 449, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, -1, -1, -1, -1, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, 409, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 635, 636, 637, 638, 639, 640, 641, 642, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455}
+			{{0, 33, 22}, {33, 1, 518}, {34, 4, 262}, {38, 25, 55}, {89, 34, 99}, {133, 24, 141}, {167, 3, 292}, {173, 2, 617}, {175, 6, 447}, {181, 30, 171}, {215, 1, 417}, {216, 4, 335}, {220, 27, 204}, {247, 7, 339}, {254, 4, 406}, {258, 16, 619}, {291, 8, 635}, {299, 16, 231}, {315, 12, 360}, {327, 1, 418}, {328, 3, 453}}
 		}
 	},
 	{
@@ -2033,7 +2147,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			131, 299,
 			"QKEVAKMYSSFQVMYTVGYSLSLGALLLALAILGGLSKLHCTRNAIHANLFASFVLKASSVLVIDGLLRTRYS................AVAGCRVAAVFMQYGIVANYCWLLVEGLYLHNLLGL......SFFSLYLGIGWGAPMLFVVPWAVVKCLFE...CWT.......WWILRFPVFLAILINFFIFVRIVQLLVAKLRA......DYKFRLAKSTLTLIPLLGVHEVVFAFVTD....GTLRSAKLFFDLFLSSFQGLLVAVLYCFLNKEVQSELRRRWHRWRLGKVLWEERN",
-			{19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, 580, 581, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, -1, -1, -1, 585, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 586, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, -1, -1, -1, -1, -1, -1, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465}
+			{{0, 36, 19}, {36, 4, 262}, {40, 27, 55}, {67, 3, 372}, {70, 1, 415}, {71, 2, 580}, {89, 1, 283}, {90, 35, 98}, {131, 1, 585}, {132, 27, 420}, {159, 1, 586}, {163, 3, 292}, {173, 3, 450}, {176, 29, 171}, {211, 27, 204}, {238, 2, 339}, {244, 3, 412}, {247, 14, 346}, {261, 12, 237}, {273, 12, 360}, {285, 1, 418}, {286, 13, 453}}
 		}
 	},
 	{
@@ -2041,7 +2155,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			29, 456,
 			"PLVVVLSTICLVTVGLNLLVLYAVRSERKLHTVGNLYIVSLSVADLIVGAVVMPMNILYLLM.KWSLGRPLCLFWLSMDYVASTASIFSVFILCIDRYRSVQQPLRYLKYRTKTRASATILGAWFLSFLWVIPILG...............CET....VTWFKVMTAIINFYLPTLLMLWFYAKIYKAVRQHCQHRELIN...............................................................................................................................................................................GLHMNRERKAAKQLGFIMAAFILCWIPYFIFFMVIAFC....NEHLHMFTIWLGYINSTLNPLIYPLCNENFKKTFKRILH",
-			{28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 643, 644, 645, 396, 397, 398, 399, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, 475, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 27, 28}, {27, 4, 262}, {31, 19, 55}, {50, 12, 266}, {63, 5, 279}, {68, 35, 98}, {103, 8, 284}, {111, 18, 375}, {129, 3, 643}, {132, 4, 396}, {151, 3, 292}, {158, 40, 295}, {198, 2, 474}, {375, 4, 335}, {379, 27, 204}, {406, 7, 339}, {417, 14, 346}, {431, 12, 237}, {443, 12, 360}, {455, 1, 418}}
 		}
 	},
 	{
@@ -2049,7 +2163,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			138, 294,
 			"EEQLLFLYIIYTVGYALSFSALVIASAILLGFRHLHCTRNYIHLNLFASFILRALSVFIKDAALKWMYS.................LSCRLVFLLMQYCVAANYYWLLVEGVYLYTLLAF...SEQWIFRLYVSIGWGVPLLFVVPWGIVKYLYE...CWT...NMNYWLIIRLPILFAIGVNFLIFVRVICIVVSKLKANL.CKTDIKCRLAKSTLTLIPLLGTHEVIFAFVM.....GTLRFIKLFTELSFTSFQGLMVAILYCFVNNEVQLEFRKSWERWRLEHLHIQRDS",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, 580, 581, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, 582, 583, 584, 585, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 586, -1, -1, -1, 292, 293, 294, -1, -1, -1, 618, 447, 448, 449, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, -1, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, -1, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465}
+			{{0, 32, 23}, {32, 4, 262}, {36, 27, 55}, {63, 3, 372}, {66, 1, 415}, {67, 2, 580}, {86, 34, 99}, {123, 4, 582}, {127, 27, 420}, {154, 1, 586}, {158, 3, 292}, {164, 1, 618}, {165, 6, 447}, {171, 31, 171}, {203, 3, 336}, {206, 27, 204}, {233, 1, 339}, {239, 3, 412}, {242, 14, 346}, {256, 12, 237}, {268, 12, 360}, {280, 1, 418}, {281, 13, 453}}
 		}
 	},
 	{
@@ -2057,7 +2171,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			22, 414,
 			"PWQVAFIGITTGLLSLATVTGNLLVLISFKVNTELKTVNNYFLLSLACADLIIGTFSMNLYTTYLLMGHWALGTLACDLWLALDYVASNASVMNLLLISFDRYFSVTRPLSYRAKRTPRRAALMIGLAWLVSFVLWAPAILFWQYLVG........CYI....QPIITFGTAMAAFYLPVTVMCTLYWRIYRETENRARELAAL................................................................................................................................TFSLVKEKKAARTLSAILLAFILTWTPYNIMVLVSTFC....PETLWELGYWLCYVNSTINPMCYALCNKAFRDTFRLLLLC",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 610, 611, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453}
+			{{0, 32, 23}, {32, 4, 262}, {36, 19, 55}, {55, 18, 266}, {73, 35, 98}, {108, 8, 284}, {116, 30, 138}, {146, 2, 610}, {156, 3, 292}, {163, 40, 295}, {203, 1, 474}, {332, 4, 335}, {336, 27, 204}, {363, 7, 339}, {374, 14, 346}, {388, 12, 237}, {400, 12, 360}, {412, 1, 418}, {413, 1, 453}}
 		}
 	},
 	{
@@ -2065,7 +2179,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			116, 290,
 			"LELLAEEESYFSTVKIIYTVGHSISIVALFVAITILVALRRLHCPRNYVHTQLFTTFILKAGAVFLKDAALF...........TVLCKVSVAASHFATMTNFSWLLAEAVYLNCLLAS.....RRAFWWLVLAGWGLPVLFTGTWVSCKLAFE...CWD.......WWIIKGPIVLSVGVNFGLFLNIIRILVRKL.......HTQSQYWRLSKSTLFLIPLFGIHYIIFNFL....GLGIRLPLELGLGSFQGFIVAILYCFLNQEVRTEISRKWHGHDPELLPAWRTR",
-			{563, 564, 419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, -1, -1, 584, 585, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 586, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, -1, -1, -1, -1, -1, -1, -1, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, -1, -1, -1, -1, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465}
+			{{0, 2, 563}, {2, 1, 419}, {3, 36, 19}, {39, 4, 262}, {43, 27, 55}, {70, 2, 372}, {83, 35, 98}, {123, 2, 584}, {125, 27, 420}, {152, 1, 586}, {156, 3, 292}, {166, 3, 450}, {169, 27, 171}, {203, 3, 336}, {206, 27, 204}, {237, 1, 414}, {238, 14, 346}, {252, 12, 237}, {264, 12, 360}, {276, 1, 418}, {277, 13, 453}}
 		}
 	},
 	{
@@ -2073,7 +2187,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			47, 281,
 			"TVSKLVMGLGITVCIFIMLANLLVMVAIYVNRRFHFPIYYLMANLAAADFFAGLAYFYLMFN.GPNTRRLTVSTWLLRQGLIDTSLTASVANLLAIAIERHITVFRMQLHTRMSNRRVVVVIVVIWTMAIVMGAIPSVG.................SDSYLVFWAIFNLVTFVVMVVLYAHIFGYVRQRTMRMS....GPRRNRDTMMSLLKTVVIVLGAFIICWTPGLVLLLLDVCC...DVLAYEKFFLLLAEFNSAMNPIIYSYRDKEMSATFRQILC",
-			{24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, -1, 646, 647, 279, 280, 648, 649, 650, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 466, 467, 468, 469, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, -1, -1, -1, -1, 570, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 31, 24}, {31, 4, 262}, {35, 27, 55}, {63, 2, 646}, {65, 2, 279}, {67, 3, 648}, {70, 1, 283}, {71, 35, 98}, {106, 7, 284}, {113, 26, 138}, {156, 4, 466}, {160, 34, 168}, {198, 1, 570}, {199, 1, 417}, {200, 4, 335}, {204, 27, 204}, {231, 7, 339}, {241, 1, 414}, {242, 14, 346}, {256, 12, 237}, {268, 12, 360}, {280, 1, 418}}
 		}
 	},
 	{
@@ -2081,7 +2195,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			31, 434,
 			"AGQGAAALVGGVLLIGAVLAGNSLVCVSVATERALQTPTNSFIVSLAAADLLLALLVLPLFVYSEVQG.AWLLSPRLCDALMAMDVMLCTASIFNLCAISVDRFVAVAVPLRYNRQGGSRRQLLLIGATWLLSAAVAAPVLCG...........CRL.DRDYVVYSSVCSFFLPCPLMLLLYWATFRGLQRWEVARRAK.........................................................................................................................................................AKITGRERKAMRVLPVVVGAFLLCWTPFFVVHITQALC.....PPRLVSAVTWLGYVNSALNPVIYTVFNAEFRNVFRKALR",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 32, 23}, {32, 4, 262}, {36, 19, 55}, {55, 13, 266}, {69, 5, 279}, {74, 35, 98}, {109, 8, 284}, {117, 26, 375}, {154, 3, 292}, {158, 40, 295}, {198, 1, 474}, {352, 4, 335}, {356, 27, 204}, {383, 7, 339}, {395, 14, 346}, {409, 12, 237}, {421, 12, 360}, {433, 1, 418}}
 		}
 	},
 	{
@@ -2089,7 +2203,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			32, 384,
 			"TVSYQVITSLLLGTLIFCAVLGNACVVAAIALERSLQNVANYLIGSLAVTDLMVSVLVLPMAALYQVLNKWTLGQVTCDLFIALDVLCCTSSILHLCAIALDRYWAITDPIDYVNKRTPRRAAALISLTWLIGFLISIPPMLGW...........CTI..DHGYTIYSTFGAFYIPLLLMLVLYGRIFRAARFRIRKTVKKV..........................................................................................KNERNAEAKRKMALARERKTVKTLGIIMGTFILCWLPFFIVALVLPFC......PTLLGAIINWLGYSNSLLNPVIYAYFNKDFQNAFKKII",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, 475, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 651, 652, 653, 654, 655, 656, 614, 595, 570, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371}
+			{{0, 33, 22}, {33, 4, 262}, {37, 19, 55}, {56, 18, 266}, {74, 35, 98}, {109, 8, 284}, {117, 27, 138}, {155, 3, 292}, {160, 40, 295}, {200, 2, 474}, {292, 6, 651}, {298, 1, 614}, {299, 1, 595}, {300, 1, 570}, {301, 1, 417}, {302, 4, 335}, {306, 27, 204}, {333, 7, 339}, {346, 14, 346}, {360, 12, 237}, {372, 12, 360}}
 		}
 	},
 	{
@@ -2097,7 +2211,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			18, 341,
 			"TITEKMLICMTLVVITTLTTLLNLAVIMAIGTTKKLHQPANYLICSLAVTDLLVAVLVMPLSIIYIVMDRWKLGYFLCEVWLSVDMTCCTCSILHLCVIALDRYWAITNAIEYARKRTAKRAALMILTVWTISIFISMPPLFW............CTI...HVIYTIYSTLGAFYIPLTLILILYYRIYHAAKSLYQKRGSSR...........................................................QISSTRERKAARILGLILGAFILSWLPFFIKELIVGLS....SSEVADFLTWLGYVNSLINPLLYTSFNEDFKLAFKKL",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, 475, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370}
+			{{0, 33, 22}, {33, 4, 262}, {37, 19, 55}, {56, 18, 266}, {74, 35, 98}, {109, 8, 284}, {117, 26, 138}, {155, 3, 292}, {161, 40, 295}, {201, 2, 474}, {262, 4, 335}, {266, 27, 204}, {293, 7, 339}, {304, 14, 346}, {318, 12, 237}, {330, 11, 360}}
 		}
 	},
 	{
@@ -2105,7 +2219,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			34, 338,
 			"LQALKISLAVVLSVITLATVLSNAFVLTTILLTRKLHTPANYLIGSLATTDLLVSILVMPISIAYTITHTWNFGQILCDIWLSSDITCCTASILHLCVIALDRYWAITDALEYSKRRTAGHAATMIAIVWAISICISIPPLFWR..........CLV...QISYTIYSTCGAFYIPSVLLIILYGRIYRAARNRILNPPS........................................................RISAARERKATKILGIILGAFIICWLPFFVVSLVLPIC......HPALFDFFTWLGYLNSLINPIIYTVFNEEFRQAFQKIV",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371}
+			{{0, 33, 22}, {33, 4, 262}, {37, 19, 55}, {56, 18, 266}, {74, 35, 98}, {109, 8, 284}, {117, 27, 138}, {154, 3, 292}, {160, 40, 295}, {256, 4, 335}, {260, 27, 204}, {287, 7, 339}, {300, 14, 346}, {314, 12, 237}, {326, 12, 360}}
 		}
 	},
 	{
@@ -2113,7 +2227,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			26, 374,
 			"ARPHAYYALSYCALILAIVFGNGLVCMAVLKERALQTTTNYLVVSLAVADLLVATLVMPWVVYLEVTG.VWNFSRICCDVFVTLDVMMCTASILNLCAISIDRYTAVVMPVHYQHGTG..SCRRVALMITAVWVLAFAVSCPLLFG.........CSI.NPDFVIYSSVVSFYLPFGVTVLVYARIYVVLKQRRRKRILTR...........................................................................................RGVPLREKKATQMVAIVLGAFIVCWLPFFLTHVLNTHC.....SPELYSATTWLGYVNSALNPVIYTTFNIEFRKAFLKILS",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 470, -1, -1, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, 475, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 32, 23}, {32, 4, 262}, {36, 19, 55}, {55, 13, 266}, {69, 5, 279}, {74, 35, 98}, {109, 8, 284}, {117, 1, 470}, {120, 26, 375}, {155, 3, 292}, {159, 40, 295}, {199, 2, 474}, {292, 4, 335}, {296, 27, 204}, {323, 7, 339}, {335, 14, 346}, {349, 12, 237}, {361, 12, 360}, {373, 1, 418}}
 		}
 	},
 	{
@@ -2121,7 +2235,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			57, 290,
 			"AIPVIITAVYSVVFVVGLVGNSLVMFVIIRYTKMKTATNIYIFNLALADALVTTTMPFQSTVYLMNSWPFGDVLCKIVISIDYYNMFTSIFTLTMMSVDRYIAVCHPVKALDFRTPLKAKIINICIWLLSSSVGISAIVLG............CSL.....DYSWWDLFMKICVFIFAFVIPVLIIIVCYTLMILRLKSV.....SREKDRNLRRITRLVLVVVAVFVVCWTPIHIFILVEALG....STAALSSYYFCIALGYTNSSLNPILYAFLDENFKRCFRDFCF",
-			{24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, 416, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, -1, -1, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 31, 24}, {31, 4, 262}, {35, 27, 55}, {62, 3, 372}, {65, 1, 415}, {66, 5, 279}, {71, 35, 98}, {106, 8, 284}, {114, 27, 138}, {153, 3, 292}, {161, 1, 416}, {162, 4, 402}, {166, 34, 295}, {205, 1, 417}, {206, 4, 335}, {210, 27, 204}, {237, 7, 339}, {248, 3, 412}, {251, 14, 346}, {265, 12, 237}, {277, 12, 360}, {289, 1, 418}}
 		}
 	},
 	{
@@ -2129,7 +2243,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			99, 291,
 			"SWLTLFVPSVYTGVFVVSLPLNIMAIVVFILKMKVKKPAVVYMLHLATADVLFVSVLPFKISYYFS..DWQFGSELCRFVTAAFYCNMYASILLMTVISIDRFLAVVYPMQSLSWRTLGRASFTCLAIWALAIAGVVPLLLK.............CHD.......EGYYAYYFSAFSAVFFFVPLIISTVCYVSIIRCLSS....NRSKKSRALFLSAAVFCIFIICFGPTNVLLIAHYSFL.....TEAAYFAYLLCVCVSSISCCIDPLIYYYASSECQRYVYSILCCK",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, -1, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, 657, 658, 568, 569, 466, 467, 468, 469, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, -1, -1, -1, -1, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, -1, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454}
+			{{0, 32, 23}, {32, 4, 262}, {36, 27, 55}, {63, 3, 372}, {68, 5, 279}, {73, 35, 98}, {108, 8, 284}, {116, 26, 375}, {155, 3, 292}, {165, 2, 657}, {167, 2, 568}, {169, 4, 466}, {173, 28, 168}, {205, 37, 478}, {247, 3, 412}, {250, 14, 346}, {264, 12, 237}, {276, 12, 360}, {288, 1, 418}, {289, 2, 453}}
 		}
 	},
 	{
@@ -2137,7 +2251,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			10, 304,
 			"DSEFRYTLFPIVYSIIFVLGVIANGYVLWVFARLY....FNEIKIFMVNLTMADMLFLITLPLWIVYYQNQ.NWILPKFLCNVAGCLFFINTYCSVAFLGVITYNRFQAVTRPIKTAQANTRKRGISLSLVIWVAIVGAASYFLIL.................CFE.....SVPVLIIHIFIVFSFFLVFLIILFCNLVIIRTLLMQ....QRNAEVKRRALWMVCTVLAVFIICFVPHHVVQLPWTLAELG..DSKFHQAINDAHQVTLCLLSTNCVLDPVIYCFLTKKFRKHLTEKFYSMRS",
-			{21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 565, -1, -1, -1, -1, 567, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, 658, 568, 569, 466, 467, 468, 469, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, -1, -1, -1, -1, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456}
+			{{0, 34, 21}, {34, 1, 565}, {39, 1, 567}, {40, 27, 55}, {67, 3, 372}, {70, 1, 415}, {72, 5, 279}, {77, 35, 98}, {112, 8, 284}, {120, 26, 138}, {163, 3, 292}, {171, 1, 658}, {172, 2, 568}, {174, 4, 466}, {178, 29, 168}, {211, 41, 476}, {254, 2, 472}, {256, 5, 410}, {261, 14, 346}, {275, 15, 237}, {290, 9, 363}, {299, 1, 418}, {300, 4, 453}}
 		}
 	},
 	{
@@ -2145,7 +2259,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			47, 274,
 			"SPEVFVTLGVISLLENILVIVAIAKNKNLHSPMYFFICSLAVADMLVSVSNGSETIVITLL.......QSFTVNIDNVIDSVICSSLLASICSLLSIAVDRYFTIFYALQYHNIMTVKRVGIIISCIWAACTVSGILFIIYS.SSAVIICLITMFFTMLALMASLYVHMFLMARLHIKRIA.........QGANMKGAITLTILIGVFVVCWAPFFLHLIFYISC...........HFNLYLILIMCNSIIDPLIYALRSQELRKTFKEIICCY",
-			{29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, -1, -1, -1, -1, -1, -1, -1, 659, 660, 661, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, 466, 467, 468, 469, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, -1, -1, -1, -1, -1, -1, -1, -1, -1, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454}
+			{{0, 26, 29}, {26, 4, 262}, {30, 27, 55}, {57, 3, 372}, {60, 1, 415}, {68, 3, 659}, {71, 1, 283}, {72, 35, 98}, {107, 8, 284}, {115, 27, 138}, {143, 4, 466}, {147, 34, 168}, {190, 1, 338}, {191, 27, 204}, {218, 7, 339}, {236, 11, 349}, {247, 12, 237}, {259, 12, 360}, {271, 1, 418}, {272, 2, 453}}
 		}
 	},
 	{
@@ -2153,7 +2267,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			40, 302,
 			"CIFETVVIVLLTFLIIAGNLTVIFVFHCAPLLHHYTTSYFIQTMAYADLFVGVSCLVPTLSLLHY.....ESLTCQVFGYIISVLKSVSMACLACISVDRYLAITKPLSYNQLVTPCRLRICIILIWIYSCLIFLPSFF..............CAT....SAYFTGFIVCLLYAPAAFVVCFTYFHIFKICRQHTKEINDRRARF......SSRETGHSPDRRYAMVLFRITSVFYMLWLPYIIYFLLESSR...NPTLSFLTTWLAISNSFCNCVIYSLSNSVFRLGLRRLSETMCTSCMC",
-			{26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 519, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, -1, -1, -1, -1, -1, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, 475, 596, 597, 598, 599, -1, -1, -1, -1, -1, -1, 595, 570, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459, 460}
+			{{0, 29, 26}, {29, 4, 262}, {33, 1, 519}, {34, 27, 55}, {61, 3, 372}, {64, 1, 415}, {70, 1, 283}, {71, 35, 98}, {106, 8, 284}, {114, 25, 375}, {153, 3, 292}, {160, 39, 296}, {199, 2, 474}, {201, 4, 596}, {211, 1, 595}, {212, 1, 570}, {213, 1, 417}, {214, 4, 335}, {218, 27, 204}, {245, 7, 339}, {255, 14, 346}, {269, 12, 237}, {281, 12, 360}, {293, 1, 418}, {294, 8, 453}}
 		}
 	},
 	{
@@ -2161,7 +2275,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			33, 290,
 			"EPWQFSMLAAYMFLLIVLGFPINFLTLYVTVQHKKLRTPLNYILLNLAVADLFMVLGGFTSTLYTSLH.YFVFGPTGCNLEGFFATLGGEIALWSLVVLAIERYVVVCKPMSNFRFGENHAIMGVAFTWVMALACAAPPLA.............CGI.........NNESFVIYMFVVHFTIPMIIIFFCYGQLVFTVKEAAAQQ...ATTQKAEKEVTRMVIIMVIAFLICWVPYASVAFYIFTH.....GPIFMTIPAFFAKSAAIYNPVIYIMMNKQFRNCMLTTIC",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, -1, -1, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 33, 22}, {33, 4, 262}, {37, 19, 55}, {56, 12, 266}, {69, 5, 279}, {74, 35, 98}, {109, 7, 284}, {116, 25, 138}, {154, 3, 292}, {166, 1, 405}, {167, 38, 295}, {208, 4, 335}, {212, 27, 204}, {239, 7, 339}, {251, 14, 346}, {265, 12, 237}, {277, 12, 360}, {289, 1, 418}}
 		}
 	},
 	{
@@ -2169,7 +2283,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			26, 486,
 			"RLWEVITIAAVTAVVSLITIVGNVLVMISFKVNSQLKTVNNYYLLSLACADLIIGIFSMNLYTTYILMGRWALGSLACDLWLALDYVASNASVMNLLVISFDRYFSITRPLTYRAKRTPKRAGIMIGLAWLISFILWAPAILCWQYLVG........CQI....EPTITFGTAIAAFYIPVSVMTILYCRIYRETEKRTKDLADL........................................................................................................................................................................................................RVVLVKERKAAQTLSAILLAFIITWTPYNIMVLVSTFC....PVTLWHLGYWLCYVNSTVNPICYALCNRTFRKTFKMLLL",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 610, 611, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 33, 22}, {33, 4, 262}, {37, 19, 55}, {56, 18, 266}, {74, 35, 98}, {109, 8, 284}, {117, 30, 138}, {147, 2, 610}, {157, 3, 292}, {164, 40, 295}, {204, 1, 474}, {405, 4, 335}, {409, 27, 204}, {436, 7, 339}, {447, 14, 346}, {461, 12, 237}, {473, 12, 360}, {485, 1, 418}}
 		}
 	},
 	{
@@ -2177,7 +2291,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			91, 313,
 			"QGPIEIKETFKYINTVVSCLVFVLGIIGNSTLLRIIYKNKCMRNGPNILIASLALGDLLHIVIDIPINVYKLLA.DWPFGAEMCKLVPFIQKASVGITVLSLCALSIDRYRAVASWSRIKGIGVPKWTAVEIVLIWVVSVVLAVPEAIGF..............CLL.....TAFMQFYKTAKDWWLFSFYFCLPLAITAFFYTLMTCEMLRKKSGM....NDHLKQRREVAKTVFCLVLVFALCWLPLHLSRILKLTLY......RCELLSFLLVLDYIGINMASLNSCINPIALYLVSKRFKNCFKSCLCC",
-			{563, 564, 419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 519, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, 662, 663, 416, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, -1, -1, -1, -1, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453}
+			{{0, 2, 563}, {2, 1, 419}, {3, 36, 19}, {39, 4, 262}, {43, 1, 519}, {44, 18, 56}, {62, 12, 266}, {75, 5, 279}, {80, 35, 98}, {115, 8, 284}, {123, 27, 375}, {164, 3, 292}, {172, 2, 662}, {174, 1, 416}, {175, 4, 402}, {179, 38, 295}, {221, 4, 335}, {225, 27, 204}, {252, 7, 339}, {259, 1, 406}, {266, 2, 472}, {268, 5, 410}, {273, 14, 346}, {287, 12, 237}, {299, 12, 360}, {311, 1, 418}, {312, 1, 453}}
 		}
 	},
 	{
@@ -2185,7 +2299,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			24, 297,
 			"HNYIFVMIPTLYSIIFVVGIFGNSLVVIVIYFYMKLKTVASVFLLNLALADLCFLLTLPLWAVYTAME.RWPFGNYLCKIASASVSFNLYASVFLLTCLSIDRYLAIVHPMKSRLRRTMLVAKVTCIIIWLLAGLASLPAIIHR............CAF........LPIGLGLTKNILGFLFPFLIILTSYTLIWKALKKA.......PRNDDIFKIIMAIVLFFFFSWIPHQIFTFLDVLIQLG...DCRIADIVDTAMPITICIAYFNNCLNPLFYGFLGKKFKRYFLQLLKYI",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, -1, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, -1, -1, -1, -1, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, -1, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454}
+			{{0, 33, 22}, {33, 4, 262}, {37, 27, 55}, {64, 3, 372}, {67, 1, 415}, {69, 5, 279}, {74, 35, 98}, {109, 8, 284}, {117, 27, 375}, {156, 3, 292}, {167, 1, 405}, {168, 34, 295}, {209, 27, 204}, {236, 7, 339}, {243, 3, 406}, {249, 2, 472}, {251, 5, 410}, {256, 14, 346}, {270, 12, 237}, {282, 12, 360}, {294, 1, 418}, {295, 2, 453}}
 		}
 	},
 	{
@@ -2193,7 +2307,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			42, 286,
 			"ENSIKLTSVVFILICCFIILENIFVLLTIWKTKKFHRPMYYFIGNLALSDLLAGVAYTANLLL.GATTYKLTPAQWFLREGSMFVALSASVFSLLAIAIERYITMLKMKLHNGSNNFRLFLLISACWVISLILGGLPIMG.................HKHYILFCTTVFTLLLLSIVILYCRIYSLVRTRSRRLT........SRSSEKSLALLKTVIIVLSVFIACWAPLFILLLLDVGC.....DILFRAEYFLVLAVLNSGTNPIIYTLTNKEMRRAFIRIMS",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, -1, 646, 647, 279, 280, 648, 649, 650, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 466, 467, 468, 469, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 32, 23}, {32, 4, 262}, {36, 27, 55}, {64, 2, 646}, {66, 2, 279}, {68, 3, 648}, {71, 1, 283}, {72, 35, 98}, {107, 7, 284}, {114, 26, 138}, {157, 4, 466}, {161, 34, 168}, {203, 4, 335}, {207, 27, 204}, {234, 7, 339}, {246, 1, 414}, {247, 14, 346}, {261, 12, 237}, {273, 12, 360}, {285, 1, 418}}
 		}
 	},
 	{
@@ -2201,7 +2315,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			28, 293,
 			"PAWQIVLWAAAYTVIVVTSVVGNVVVMWIILAHKRMRTVTNYFLVNLAFAEASMAAFNTVVNFTYAVHNEWYYGLFYCKFHNFFPIAAVFASIYSMTAVAFDRYMAIIH......SATATKVVICVIWVLALLLAFPQGYYS..........CMI.....PNKIYEKVYHICVTVLIYFLPLLVIGYAYTVVGITLWASEIPGD...RYHEQVSAKRKVVKMMIVVVCTFAICWLPFHIFFLLPYIN.......FIQQVYLAIMWLAMSSTMYNPIIYCCLNDRFRLGFKHAF",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, 580, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, -1, -1, -1, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, 416, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, -1, -1, -1, 570, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, -1, -1, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371}
+			{{0, 33, 22}, {33, 4, 262}, {37, 27, 55}, {64, 3, 372}, {67, 1, 415}, {68, 1, 580}, {69, 5, 279}, {74, 35, 98}, {115, 27, 375}, {152, 3, 292}, {160, 1, 416}, {161, 4, 402}, {165, 39, 295}, {207, 1, 570}, {208, 1, 417}, {209, 4, 335}, {213, 27, 204}, {240, 7, 339}, {254, 1, 414}, {255, 14, 346}, {269, 12, 237}, {281, 12, 360}}
 		}
 	},
 	{
@@ -2209,7 +2323,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			212, 301,
 			"SRSAKEFTDIWMAVWASLCFISTAFTVLTFLIDSSRFSYPERPIIFLSMCYNIYSIAYIVRLTVG......................NTGCAIIFLLMYFFGMASSIWWVILTLTWFLAAG..........HSSYFHIAAWAIPAVKTIVILIMR..........CYV...NLDALTGFVVAPLFTYLVIGTLFIAAGLVALFKIRSNL..........ERLMVKIGVFSVLYTVPATCVIACYFYEISN...........NMAVEMLKIFMSLLVGITSGMWIWSAKTLHTWQKCSNRLV",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 518, 262, 263, 264, 265, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, 617, 618, 447, 448, 449, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 635, 636, 637, 638, 639, 640, 641, 642, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455}
+			{{0, 33, 22}, {33, 1, 518}, {34, 4, 262}, {38, 26, 56}, {64, 1, 372}, {87, 34, 98}, {131, 24, 141}, {165, 3, 292}, {171, 2, 617}, {173, 6, 447}, {179, 30, 171}, {219, 24, 207}, {243, 7, 339}, {261, 8, 635}, {269, 16, 231}, {285, 12, 360}, {297, 1, 418}, {298, 3, 453}}
 		}
 	},
 	{
@@ -2217,7 +2331,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			11, 301,
 			"SATCHDTIDDFRNQVYSTLYSMISVVGFFGNGFVLYVLIKT....SAFQVYMINLAVADLLCVCTLPLRVVYYVHK.IWLFGDFLCRLSTYALYVNLYCSIFFMTAMSFFRCIAIVFPVQNINLVTQKKARFVCVGIWIFVILTSSPFLMA...........CFE...DNQTKNHVLVLHYVSLFVGFIIPFVIIIVCYTMIILTLLK.....NLSSHKKAIGMIMVVTAAFLVSFMPYHIQRTIHLHFLHN...PCDSVLRMQKSVVITLSLAASNCCFDPLLYFFSGGNFRKRLSTFRK",
-			{609, 579, 563, 564, 419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, -1, -1, -1, -1, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, 662, 663, 416, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, -1, -1, -1, -1, -1, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, -1, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 1, 609}, {1, 1, 579}, {2, 2, 563}, {4, 1, 419}, {5, 36, 19}, {45, 27, 55}, {72, 3, 372}, {75, 1, 415}, {77, 5, 279}, {82, 35, 98}, {117, 8, 284}, {125, 26, 375}, {162, 3, 292}, {168, 2, 662}, {170, 1, 416}, {171, 4, 402}, {175, 33, 295}, {213, 39, 478}, {255, 2, 472}, {257, 5, 410}, {262, 14, 346}, {276, 12, 237}, {288, 12, 360}, {300, 1, 418}}
 		}
 	},
 	{
@@ -2225,7 +2339,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			61, 328,
 			"IYSKVLVTAIYLALFVVGTVGNSVTAFTLARK....SLQSTVHYHLGSLALSDLLILLLAMPVELYNFIWV..PWAFGDAGCRGYYFLRDACTYATALNVASLSVERYLAICHPFKAKTLMSRSRTKKFISAIWLASALLAIPMLFTM................CTP...TATVKVVIQVNTFMSFLFPMLVISILNTVIANKLTVMVHQAAEQG.....................PGRVQALRHGVLVLRAVVIAFVVCWLPYHVRRLMFCYI.....TTFLFDFYHYFYMLTNALFYVSSAINPILYNLVSANFRQVFLSTLACLC",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, -1, -1, -1, -1, 573, 574, 567, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, -1, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, 475, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455}
+			{{0, 32, 23}, {36, 2, 573}, {38, 1, 567}, {39, 19, 55}, {58, 13, 266}, {73, 5, 279}, {78, 35, 98}, {113, 8, 284}, {121, 27, 375}, {164, 3, 292}, {170, 3, 403}, {173, 40, 295}, {213, 2, 474}, {236, 4, 335}, {240, 27, 204}, {267, 7, 339}, {279, 2, 472}, {281, 5, 410}, {286, 14, 346}, {300, 12, 237}, {312, 12, 360}, {324, 1, 418}, {325, 3, 453}}
 		}
 	},
 	{
@@ -2233,7 +2347,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			18, 329,
 			"NSPVTIPAVMFIFGVVGNLVAIVVLCKS......TTFYTLVCGLAVTDLLGTLLVSPVTIATYMK.QWPGGQPLCEYSTFILLFFSLSGLSIICAMSVERYLAINHAYFYSHYVDKRLAGLTLFAVYASNVLFCALPNMG............CFI.....VTAHAAYSYMYAGFSSFLILATVLCNVLVCGALLRMHRQFMRRT.......................................RRIAGAEIQMVILLIATSLVVLICSIPLVVRVFVNQLY..........NPDLQAIRIASVNPILDPWIYILLRKTVLSKAIEKIKC",
-			{27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, -1, -1, -1, -1, -1, -1, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, 658, 568, 569, 466, 467, 468, 469, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 612, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453}
+			{{0, 28, 27}, {34, 19, 55}, {53, 12, 266}, {66, 5, 279}, {71, 35, 98}, {106, 8, 284}, {114, 26, 138}, {152, 3, 292}, {160, 1, 658}, {161, 2, 568}, {163, 4, 466}, {167, 36, 168}, {203, 1, 612}, {243, 4, 335}, {247, 27, 204}, {274, 7, 339}, {291, 12, 348}, {303, 12, 237}, {315, 12, 360}, {327, 1, 418}, {328, 1, 453}}
 		}
 	},
 	{
@@ -2241,7 +2355,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			53, 343,
 			"KLHWAALLILMVIIPTIGGNTLVILAVSLEKKLQYATNYFLMSLAVADLLVGLFVMPIALLTIMF..MWPLPLVLCPAWLFLDVLFSTASIMHLCAISVDRYIAIKKPIQANQYNSRATAFIKITVVWLISIGIAIPVPIKG............CVL....FGDFMLFGSLAAFFTPLAIMIVTYFLTIHALQKKAYLVKNKP.........................................................VQTISNEQRASKVLGIVFFLFLLMWCPFFITNITLVLC...NQTTLQMLLEIFVWIGYVSSGVNPLVYTLFNKTFRDAFGRYI",
-			{664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, -1, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, 475, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371}
+			{{0, 11, 664}, {11, 19, 36}, {30, 4, 262}, {34, 19, 55}, {53, 12, 266}, {67, 5, 279}, {72, 35, 98}, {107, 8, 284}, {115, 27, 375}, {154, 3, 292}, {161, 40, 295}, {201, 2, 474}, {260, 4, 335}, {264, 27, 204}, {291, 7, 339}, {301, 4, 411}, {305, 14, 346}, {319, 12, 237}, {331, 12, 360}}
 		}
 	},
 	{
@@ -2249,7 +2363,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			45, 292,
 			"DAIPILYYIIFVIGFLVNIVVVTLFCCQ.....VSSIYIFNLAVADLLLLATLPLWATYYSYR.DWLFGPVMCKVFGSFLTLNMFASIFFITCMSVDRYQSVIYPFLSQRRNPWQASYIVPLVWCMACLSSLPTFYFR............CIM.....KYAQWSAGIALMKNILGFIIPLIFIATCYFGIRKHLLKT...GKNRITRDQVLKMAAAVVLAFIICWLPFHVLTFLDALAWMG...SCEVIAVIDLALPFAILLGFTNSCVNPFLYCFVGNRFQQKLRSVFRVP",
-			{27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, -1, -1, -1, -1, -1, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, 416, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, -1, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454}
+			{{0, 28, 27}, {33, 26, 56}, {59, 3, 372}, {62, 1, 415}, {64, 5, 279}, {69, 35, 98}, {104, 7, 284}, {111, 27, 375}, {150, 3, 292}, {158, 1, 416}, {159, 4, 402}, {163, 34, 295}, {200, 4, 335}, {204, 27, 204}, {231, 7, 339}, {238, 3, 406}, {244, 2, 472}, {246, 5, 410}, {251, 14, 346}, {265, 12, 237}, {277, 12, 360}, {289, 1, 418}, {290, 2, 453}}
 		}
 	},
 	{
@@ -2257,7 +2371,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			14, 283,
 			"PKGALGLSLALASLIITANLLLALGIAWDRRLRSPPAGCFFLSLLLAGLLTGLALPTLPGL......GYWSCLLVYLAPNFSFLSLLANLLLVHGERYMAVLR......SIRLALLLTWAGPLLFASLPALG.........CSS....PAPYLYLEVYGLLLPAVGAAAFLSVRVLATAHRQLQDICRLERAVC....SALARALTWRQARAQAGAMLLFGLCWGPYVATLLLSVLAYEQ....GPGTLLSLLSLGSASAAAVPVAMGLGDQRYTAPWRAAAQ",
-			{26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 567, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, -1, -1, -1, -1, -1, -1, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, -1, -1, -1, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, 475, 596, 597, 598, 599, -1, -1, -1, -1, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 29, 26}, {29, 4, 262}, {33, 1, 567}, {34, 27, 55}, {67, 1, 283}, {68, 35, 98}, {109, 23, 141}, {141, 3, 292}, {148, 40, 295}, {188, 2, 474}, {190, 4, 596}, {198, 1, 417}, {199, 4, 335}, {203, 27, 204}, {230, 7, 339}, {237, 3, 406}, {244, 14, 346}, {258, 12, 237}, {270, 12, 360}, {282, 1, 418}}
 		}
 	},
 	{
@@ -2265,7 +2379,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			43, 299,
 			"VRQFASHFLPPLYWLVFIVGALGNSLVILVYWYCTRVKTMTDMFLLNLAIADLLFLVTLPFWAIAAADQWKFQTFMCKVVNSMYKMNFYSCVLLIMCISVDRYIAIAQAMRAHTWREKRLLYSKMVCFTIWVLAAALCIPEILYS..........CTM........KLKSAVLTLKVILGFFLPFVVMACCYTIIIHTLIQA..SSKHKALKVTITVLTVFVLSQFPYNCILLVQTIDAYAM...NCAVSTNIDICFQVTQTIAFFHSCLNPVLYVFVGERFRRDLVKTLKNLGCISQA",
-			{21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 576, 577, 578, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, -1, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, 409, -1, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459, 460}
+			{{0, 34, 21}, {34, 4, 262}, {38, 27, 55}, {65, 3, 372}, {68, 5, 279}, {73, 35, 98}, {108, 7, 284}, {115, 3, 576}, {118, 27, 375}, {155, 3, 292}, {166, 2, 404}, {168, 34, 295}, {204, 27, 204}, {231, 7, 339}, {238, 4, 406}, {245, 2, 472}, {247, 5, 410}, {252, 14, 346}, {266, 12, 237}, {278, 12, 360}, {290, 1, 418}, {291, 8, 453}}
 		}
 	},
 	{
@@ -2273,7 +2387,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			29, 299,
 			"ALIPAIYMLVFLLGTTGNGLVLWTVFRSSREKRRSADIFIASLAVADLTFVVTLPLWATYTYRD.DWPFGTFFCKLSSYLIFVNMYASVFCLTGLSFDRYLAIVRPVANARLRLRVSGAVATAVLWVLAALLAMPVMVLR............CYM.........SEWAWEVGLGVSSTTVGFVVPFTIMLTCYFFIAQTIAGHFRKE......KRRRLLSIIVVLVVTFALCWMPYHLVKTLYMLGSL...PCDFDLFLMNIFPYCTCISYVNSCLNPFLYAFFDPRFRQACTSMLCCG",
-			{27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 519, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, -1, -1, 416, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, -1, -1, -1, -1, -1, -1, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, -1, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454}
+			{{0, 28, 27}, {28, 4, 262}, {32, 1, 519}, {33, 27, 55}, {60, 3, 372}, {63, 1, 415}, {65, 5, 279}, {70, 35, 98}, {105, 8, 284}, {113, 27, 375}, {152, 3, 292}, {164, 1, 416}, {165, 4, 402}, {169, 38, 295}, {213, 26, 205}, {239, 7, 339}, {246, 2, 406}, {251, 2, 472}, {253, 5, 410}, {258, 14, 346}, {272, 12, 237}, {284, 12, 360}, {296, 1, 418}, {297, 2, 453}}
 		}
 	},
 	{
@@ -2281,7 +2395,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			46, 333,
 			"EWVLIAAYVAVFVVALVGNTLVCLAVWRNHHMRTVTNYFIVNLSLADVLVTAICLPASLLVDITESWLFGHALCKVIPYLQAVSVSVAVLTLSFIALDRWYAICHPLLF..TARRARGSILGIWAVSLAIMVPQAAVM..................CDE.....LYPKIYHSCFFIVTYLAPLGLMAMAYFQIFRKLWGRQIP..................................FLAEVKQMRARRKTAKMLMVVLLVFALCYLPISVLNVLKRVF.......DREAVYACFTFSHWLVYANSAANPIIYNFLSGKFREQFKAAFSCCLP",
-			{26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, -1, -1, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 614, 595, 570, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, -1, -1, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456}
+			{{0, 29, 26}, {29, 4, 262}, {33, 19, 55}, {52, 18, 266}, {70, 35, 98}, {105, 4, 284}, {111, 27, 375}, {156, 3, 292}, {164, 2, 404}, {166, 37, 295}, {237, 1, 614}, {238, 1, 595}, {239, 1, 570}, {240, 1, 417}, {241, 4, 335}, {245, 27, 204}, {272, 7, 339}, {286, 4, 411}, {290, 14, 346}, {304, 12, 237}, {316, 12, 360}, {328, 1, 418}, {329, 4, 453}}
 		}
 	},
 	{
@@ -2289,7 +2403,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			131, 287,
 			"SNEKRHSYLLKLKVMYTVGYSSSLVMLLVALGILCAFRRLHCTRNYIHMHLFVSFILRALSNFIKDAVL............RAGCKLVMVLFQYCIMANYSWLLVEGLYLHTLLAI...SERKYLQGFVAFGWGSPAIFVALWAIARHFLE...CWD...NASIWWIIRGPVILSILINFILFINILRILMRKLRT.....NEVSHYKRLARSTLLLIPLFGIHYIVFAFS...AMEIQLFFELALGSFQGLVVAVLYCFLNGEVQLEVQKKWQQWHLREFPLHPVA",
-			{419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, 582, 583, 584, 585, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 586, -1, -1, -1, 292, 293, 294, -1, -1, -1, 618, 447, 448, 449, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, -1, -1, -1, -1, -1, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, -1, -1, -1, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465}
+			{{0, 1, 419}, {1, 36, 19}, {37, 4, 262}, {41, 27, 55}, {68, 1, 372}, {81, 35, 98}, {119, 4, 582}, {123, 27, 420}, {150, 1, 586}, {154, 3, 292}, {160, 1, 618}, {161, 6, 447}, {167, 29, 171}, {201, 3, 336}, {204, 27, 204}, {234, 1, 414}, {235, 14, 346}, {249, 12, 237}, {261, 12, 360}, {273, 1, 418}, {274, 13, 453}}
 		}
 	},
 	{
@@ -2297,7 +2411,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			6, 309,
 			"SAFQAAYIGIEVLIALVSVPGNVLVIWAVKVNQALRDATFCFIVSLAVADVAVGALVIPLAILINIGPQTYFHTCLMVACPVLILTQSSILALLAIAVDRYLRVKIPLRYKMVVTPRRAAVAIAGCWILSFVVGLTPMFG.......................CEF....SMEYMVYFNFFVWVLPPLLLMVLIYLEVFYLIRKQLNKKV.....DPQKYYGKELKIAKSLALILFLFALSWLPLHILNCITLFC.....PSILTYIAIFLTHGNSAMNPIVYAFRIQKFRVTFLKIWNDHFRCQPAPP",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 587, 588, 589, 590, 591, 592, 593, 594, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, -1, -1, -1, -1, -1, 570, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462}
+			{{0, 32, 23}, {32, 4, 262}, {36, 19, 55}, {55, 12, 266}, {67, 4, 280}, {71, 35, 98}, {106, 8, 284}, {114, 26, 138}, {163, 3, 292}, {170, 8, 587}, {178, 32, 302}, {215, 1, 570}, {216, 1, 417}, {217, 4, 335}, {221, 27, 204}, {248, 7, 339}, {260, 14, 346}, {274, 12, 237}, {286, 12, 360}, {298, 1, 418}, {299, 10, 453}}
 		}
 	},
 	{
@@ -2305,7 +2419,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			48, 288,
 			"LGLKVTIVGLYLAVCVGGLLGNCLVMYVILRHTKMKTATNIYIFNLALADTLVLLTLPFQGTDILLGFWPFGNALCKTVIAIDYYNMFTSTFTLTAMSVDRYVAICHPIRALDVRTSSKAQAVNVAIWALASVVGVPVAIMG..........CLV....PQDYWGPVFAICIFLFSFIVPVLVISVCYSLMIRRLRGV.....SREKDRNLRRITRLVLVVVAVFVGCWTPVQVFVLAQGLG....SETAVAILRFCTALGYVNSCLNPILYAFLDENFKACFRKFCC",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 416, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, -1, -1, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 32, 23}, {32, 4, 262}, {36, 27, 55}, {63, 3, 372}, {66, 1, 415}, {67, 5, 279}, {72, 35, 98}, {107, 8, 284}, {115, 27, 138}, {152, 3, 292}, {159, 1, 416}, {160, 4, 402}, {164, 34, 295}, {203, 1, 417}, {204, 4, 335}, {208, 27, 204}, {235, 7, 339}, {246, 3, 412}, {249, 14, 346}, {263, 12, 237}, {275, 12, 360}, {287, 1, 418}}
 		}
 	},
 	{
@@ -2313,7 +2427,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			22, 292,
 			"KINVKQIAARLLPPLYSLVFIFGFVGNMLVILILINCKRLKSMTDIYLLNLAISDLFFLLTVPFWAHYAAAQWDFGNTMCQLLTGLYFIGFFSGIFFIILLTIDRYLAVVHAVFALKARTVTFGVVTSVITWVVAVFASLPGIIFT..........CSS.....QYQFWKNFQTLKIVILGLVLPLLVMVICYSGILKTLLRC...KKRHRAVRLIFTIMIVYFLFWAPYNIVLLLNTFQEFFG..NCSSSNRLDQAMQVTETLGMTHCCINPIIYAFVGEKFRNYLLVFFQ",
-			{419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, 416, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, 409, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 1, 419}, {1, 36, 19}, {37, 4, 262}, {41, 27, 55}, {68, 3, 372}, {71, 5, 279}, {76, 35, 98}, {111, 8, 284}, {119, 27, 375}, {156, 3, 292}, {164, 1, 416}, {165, 4, 402}, {169, 34, 295}, {206, 27, 204}, {233, 7, 339}, {240, 4, 406}, {246, 2, 472}, {248, 5, 410}, {253, 14, 346}, {267, 12, 237}, {279, 12, 360}, {291, 1, 418}}
 		}
 	},
 	{
@@ -2321,7 +2435,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			139, 291,
 			"YESETGDQDYYYLSVKALYTVGYSTSLVTLTTAMVILCRFRKLHCTRNFIHMNLFVSFMLRAISVFIKDWIL............TVECKAVMVFFHYCVVSNYFWLFIEGLYLFTLLVE......RYFYWYTIIGWGTPTVCVTVWATLRLYFD...CWD...STALWWVIKGPVVGSIMVNFVLFIGIIVILVQKL.......NESSIYLRLARSTLLLIPLFGIHYTVFAFS.....KRERLVFELGLGSFQGFVVAVLYCFLNGEVQAEIKRKWRSWKVNRYFAVDFK",
-			{579, 563, 564, 419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, -1, -1, -1, 585, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 586, -1, -1, -1, 292, 293, 294, -1, -1, -1, 618, 447, 448, 449, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, -1, -1, -1, -1, -1, -1, -1, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465}
+			{{0, 1, 579}, {1, 2, 563}, {3, 1, 419}, {4, 36, 19}, {40, 4, 262}, {44, 27, 55}, {71, 1, 372}, {84, 35, 98}, {125, 1, 585}, {126, 27, 420}, {153, 1, 586}, {157, 3, 292}, {163, 1, 618}, {164, 6, 447}, {170, 27, 171}, {204, 3, 336}, {207, 27, 204}, {239, 14, 346}, {253, 12, 237}, {265, 12, 360}, {277, 1, 418}, {278, 13, 453}}
 		}
 	},
 	{
@@ -2329,7 +2443,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			21, 292,
 			"YKITQVLFPLLYTVLFFVGLITNGLAMRIFFQI...SNFIIFLKNTVISDLLMILTFPFKILSDAK...GPLRTFVCQVTSVIFYFTMYISISFLGLITIDRYQKTTRPFKTSNPKNLLGAKILSVVIWAFMFLLSLPNMILT...........CSF...EFGLVWHEIVNYICQVIFWINFLIVIVCYTLITKELYRSYVRT......PRKKVNVKVFIIIAVFFICFVPFHFARIPYTLSQTR...DCTAENTLFYVKESTLWLTSLNACLDPFIYFFLCKSFRNSLISM",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, -1, -1, -1, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, -1, -1, -1, 659, 660, 661, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, 675, 676, 657, 658, 568, 569, 466, 467, 468, 469, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, -1, -1, -1, -1, -1, -1, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, -1, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370}
+			{{0, 33, 22}, {36, 27, 55}, {63, 3, 372}, {69, 3, 659}, {72, 1, 283}, {73, 35, 98}, {108, 8, 284}, {116, 27, 138}, {154, 3, 292}, {160, 2, 675}, {162, 2, 657}, {164, 2, 568}, {166, 4, 466}, {170, 33, 168}, {209, 36, 481}, {248, 2, 472}, {250, 5, 410}, {255, 14, 346}, {269, 12, 237}, {281, 11, 360}}
 		}
 	},
 	{
@@ -2337,7 +2451,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			27, 305,
 			"SPWFAASFCVVGLASNLLALSVLAGARQ......SSFLTFLCGLVLTDFLGLLVTGTIVVSQHAA..EWHAV...CRLCRFMGVVMIFFGLSPLLLGAAMASERYLGITRPFSRPAVASQRRAWATVGLVWAAALALGLLPLLG............CFL....ESGDVAFGLLFSMLGGLSVGLSFLLNTVSVATLCHVYHGQ....QRPRDSEVEMMAQLLGIMVVASVCWLPLLVFIAQTVLR...........SRTTEKELLIYLRVATWNQILDPWVYILFRRAVLRRLQPRLSTRPRSLS",
-			{29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 565, 566, -1, -1, -1, -1, -1, -1, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, -1, -1, 279, 280, 648, 649, 650, -1, -1, -1, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 658, 568, 569, 466, 467, 468, 469, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, -1, -1, -1, -1, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459}
+			{{0, 26, 29}, {26, 2, 565}, {34, 19, 55}, {53, 12, 266}, {67, 2, 279}, {69, 3, 648}, {75, 35, 98}, {110, 8, 284}, {118, 26, 138}, {156, 3, 292}, {163, 1, 658}, {164, 2, 568}, {166, 4, 466}, {170, 33, 168}, {207, 38, 476}, {256, 3, 412}, {259, 14, 346}, {273, 12, 237}, {285, 12, 360}, {297, 1, 418}, {298, 7, 453}}
 		}
 	},
 	{
@@ -2345,7 +2459,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			129, 289,
 			"ASLDEQQTMFYGSVKTGYTIGYGLSLATLLVATAILSLFRKLHCTRNYIHMHLFISFILRAAAVFIKDLAL............SVGCKAAMVFFQYCVMANFFWLLVEGLYLYTLLAV...SERKYFWGYILIGWGVPSTFTMVWTIARIHFE...CWD..NSSLWWIIKGPILTSILVNFILFICIIRILLQKL.......SDSSPYSRLARSTLLLIPLFGVHYIMFAFF.....PEVKMVFELVVGSFQGFVVAILYCFLNGEVQAELRRKWRRWHLQGVLGWNPK",
-			{563, 564, 419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, 582, 583, 584, 585, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 586, -1, -1, -1, 292, 293, 294, -1, -1, 618, 447, 448, 449, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, -1, -1, -1, -1, -1, -1, -1, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465}
+			{{0, 2, 563}, {2, 1, 419}, {3, 36, 19}, {39, 4, 262}, {43, 27, 55}, {70, 1, 372}, {83, 35, 98}, {121, 4, 582}, {125, 27, 420}, {152, 1, 586}, {156, 3, 292}, {161, 1, 618}, {162, 6, 447}, {168, 27, 171}, {202, 3, 336}, {205, 27, 204}, {237, 14, 346}, {251, 12, 237}, {263, 12, 360}, {275, 1, 418}, {276, 13, 453}}
 		}
 	},
 	{
@@ -2353,7 +2467,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			591, 263,
 			"IESIIAIAFSCLGILVTLFVTLIFVLY..TPVVKSSSRELCYIILAGIFLGYVCPFTLI....TTSCYLQRLLVGLSSAMCYSALVTKTNRIARIL...............SAWAQVIIASILISVQLTLVVTLIIME.................CNTSNLGVVAPLGYNGLLIMSCTYYAFKT........EAKYIAFTMYTTCIIWLAFVPIYFGS.YKIITTCFAVSLSVTVALGCMFTPKMYIIIAKPERNVRSAFTTS",
-			{28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, -1, -1, 518, 262, 263, 264, 265, 519, 520, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, -1, -1, -1, -1, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, 466, 467, 468, 469, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, -1, -1, -1, -1, -1, -1, -1, -1, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, -1, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370}
+			{{0, 27, 28}, {29, 1, 518}, {30, 4, 262}, {34, 2, 519}, {36, 23, 57}, {63, 33, 98}, {111, 27, 138}, {155, 3, 292}, {158, 4, 466}, {162, 22, 168}, {192, 22, 209}, {214, 4, 339}, {219, 33, 530}, {252, 11, 360}}
 		}
 	},
 	{
@@ -2361,7 +2475,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			54, 332,
 			"NWPALSIVIIIIMTIGGNILVIMAVSMEKKLHNATNYFLMSLAIADMLVGLLVMPLSLLAILYD.VWPLPRYLCPVWISLDVLFSTASIMHLCAISLDRYVAIRNPIEHSRFNSRTKAIMKIAIVWAISIGVSVPIPVIGLRD..........CVL.DPNFVLIGSFVAFFIPLTIMVITYCLTIYVLRRQALMLLH.................................................MQAINNERKASKVLGIVFFVFLIMWCPFFITNILSVLC....NQKLMEKLLNVFVWIGYVCSGINPLVYTLFNKIYRRAFSNYLRC",
-			{677, 678, 679, 680, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 606, 607, 608, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453}
+			{{0, 4, 677}, {4, 24, 31}, {28, 4, 262}, {32, 19, 55}, {51, 13, 266}, {65, 5, 279}, {70, 35, 98}, {105, 8, 284}, {113, 27, 375}, {140, 3, 606}, {153, 3, 292}, {157, 40, 295}, {246, 4, 335}, {250, 27, 204}, {277, 7, 339}, {288, 4, 411}, {292, 14, 346}, {306, 12, 237}, {318, 12, 360}, {330, 1, 418}, {331, 1, 453}}
 		}
 	},
 	{
@@ -2369,7 +2483,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			26, 446,
 			"RYETVEMVFIATVTGSLSLVTVVGNILVMLSIKVNRQLQTVNNYFLFSLACADLIIGAFSMNLYTVYIIKGYWPLGAVVCDLWLALDYVVSNASVMNLLIISFDRYFCVTKPLTYPARRTTKMAGLMIAAAWVLSFVLWAPAILFWQFVVG........CFI....NPAVTFGTAIAAFYLPVVIMTVLYIHISLASRSRVHKHRPE............................................................................................................................................................RQMAARERKVTRTIFAILLAFILTWTPYNVMVLVNTFC....PDTVWSIGYWLCYVNSTINPACYALCNATFKKTFRHLLLCQ",
-			{20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 610, 611, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454}
+			{{0, 35, 20}, {35, 4, 262}, {39, 19, 55}, {58, 18, 266}, {76, 35, 98}, {111, 8, 284}, {119, 30, 138}, {149, 2, 610}, {159, 3, 292}, {166, 40, 295}, {206, 1, 474}, {363, 4, 335}, {367, 27, 204}, {394, 7, 339}, {405, 14, 346}, {419, 12, 237}, {431, 12, 360}, {443, 1, 418}, {444, 2, 453}}
 		}
 	},
 	{
@@ -2377,7 +2491,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			25, 286,
 			"FTDVLNQSKPVTLFLYGVVFLFGSIGNFLVIFTITWRRRIQCSGDVYFINLAAADLLFVCTLPLWMQYLLD....ASVPCTLLTACFYVAMFASLCFITEIALDRYYAIV.....PVKQACLFSIFWWIFAVIIAIPHFM........CMT.......SYPIILNVELMLGAFVIPLSVISYCYYRISRIVAVS...HKGRIVRVLIAVVLVFIIFWLPYHLTLFVDTLKLLK....SCEFERSLKRALILTESLAFCHCCLNPLLYVFVGTKFRQELHCLLAEFR",
-			{419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, -1, -1, -1, -1, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, -1, -1, -1, -1, -1, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, -1, -1, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455}
+			{{0, 1, 419}, {1, 36, 19}, {37, 4, 262}, {41, 27, 55}, {68, 3, 372}, {75, 1, 283}, {76, 34, 98}, {115, 25, 375}, {148, 3, 292}, {158, 2, 404}, {160, 34, 295}, {197, 26, 205}, {223, 7, 339}, {230, 3, 406}, {237, 2, 472}, {239, 5, 410}, {244, 14, 346}, {258, 12, 237}, {270, 12, 360}, {282, 1, 418}, {283, 3, 453}}
 		}
 	},
 	{
@@ -2385,7 +2499,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			36, 300,
 			"PLAMIFTLALAYGAVIILGVSGNLALIIIILKQKEMRNVTNILIVNLSFSDLLVAIMCLPFTFVYTLMDHWVFGEAMCKLNPFVQCVSITVSIFSLVLIAVERHQLIIN......NNRHAYVGIAVIWVLAVASSLPFLIYQ....................CFD...SDSHRLSYTTLLLVLQYFGPLCFIFICYFKIYIRLKRRNNMMD...DNKYRSSETKRINIMLLSIVVAFAVCWLPLTIFNTVFDWN.....TCNHNLLFLLCHLTAMISTCVNPIFYGFLNKNFQRDLQFFF",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, -1, -1, -1, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, -1, -1, -1, 570, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371}
+			{{0, 33, 22}, {33, 4, 262}, {37, 19, 55}, {56, 18, 266}, {74, 35, 98}, {115, 27, 375}, {162, 3, 292}, {168, 4, 402}, {172, 39, 295}, {214, 1, 570}, {215, 1, 417}, {216, 4, 335}, {220, 27, 204}, {247, 7, 339}, {259, 3, 412}, {262, 14, 346}, {276, 12, 237}, {288, 12, 360}}
 		}
 	},
 	{
@@ -2393,7 +2507,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			4, 291,
 			"PPQLSFGLYVAAFALGFPLNVLAIRGATAHARLR.TPSLVYALNLGCSDLLLTVSLPLKAVEALAS.AWPLPASLCPVFAVAHFFPLYAGGGFLAALSAGRYLGAAFPLGYQAFRRPCYSWGVCAAIWALVLCHLGLVFGLEA.......................CLE..DPASAGPARFSLSLLLFFLPLAITAFCYVGCLRALAR.....RRKLRAAWVAGGALLTLLLCVGPYNASNVASFLY....GSWRKLGLITGAWSVVLNPLVTGYLGRGPGLKTVCAARTQ",
-			{25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 565, 566, 615, 616, -1, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, -1, -1, -1, -1, -1, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, -1, -1, -1, -1, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454}
+			{{0, 30, 25}, {30, 2, 565}, {32, 2, 615}, {35, 27, 55}, {62, 3, 372}, {65, 1, 415}, {67, 5, 279}, {72, 35, 98}, {107, 8, 284}, {115, 28, 138}, {166, 3, 292}, {171, 4, 402}, {175, 33, 295}, {213, 34, 480}, {251, 13, 347}, {264, 12, 237}, {276, 12, 360}, {288, 1, 418}, {289, 2, 453}}
 		}
 	},
 	{
@@ -2401,7 +2515,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			132, 289,
 			"TMCNAFTPEKLKNAYVLYYLAIVGHSLSIFTLVISLGIFVFFRSLGCQRVTLHKNMFLTYILNSMIIIIHLVEV...........VSCKILHFFHQYMMACNYFWMLCEGIYLHTLIVV.......RLRWYYLLGWGFPLVPTTIHAITRAVYF...CWL......LYIIHGPVMAALVVNFFFLLNIVRVLVTKMR.........YLKAVKATMILVPLLGIQFVVFPW....KMLGKIYDYVMHSLIHFQGFFVATIYCFCNNEVQTTVKRQWAQFKIQWNQRWGRR",
-			{613, 609, 579, 563, 564, 419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, -1, -1, -1, -1, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 586, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, -1, -1, -1, -1, -1, -1, -1, -1, -1, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465}
+			{{0, 1, 613}, {1, 1, 609}, {2, 1, 579}, {3, 2, 563}, {5, 1, 419}, {6, 36, 19}, {42, 4, 262}, {46, 27, 55}, {73, 1, 372}, {85, 34, 99}, {126, 27, 420}, {153, 1, 586}, {157, 3, 292}, {166, 3, 450}, {169, 28, 171}, {206, 24, 206}, {234, 3, 412}, {237, 14, 346}, {251, 12, 237}, {263, 12, 360}, {275, 1, 418}, {276, 13, 453}}
 		}
 	},
 	{
@@ -2409,7 +2523,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			17, 279,
 			"TFIPLLAMILLSVSMVVGLPGNTFVVWSILKRMRKRSVTALMVLNLALADLAVLLTAPFFLHFLTWHTWSFKLAGCRLCHYICGVSMYASVLLITAMSLDRSLAVASPFLSQKVRTKTAARWLLVGIWGASFLLATPVLAFR...........CLA...SDRHKAFHLLFEAFTGFVVPFLIVVASYADISRRLRVR....RRRTGRLVVIIILAFAAFWLPYHVVDLVEGSRVLA.....SKQQLRNARKVCIALAFLSSSVNPLLYACAGGGLLRSA",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, -1, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, -1, -1, -1, -1, -1, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256}
+			{{0, 32, 23}, {32, 4, 262}, {36, 27, 55}, {63, 3, 372}, {66, 1, 415}, {67, 5, 279}, {72, 35, 98}, {107, 8, 284}, {115, 27, 375}, {153, 3, 292}, {159, 4, 402}, {163, 34, 295}, {201, 25, 206}, {226, 7, 339}, {233, 3, 406}, {241, 4, 411}, {245, 14, 346}, {259, 20, 237}}
 		}
 	},
 	{
@@ -2417,7 +2531,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			32, 294,
 			"DHAAVLLHGLASLLGLVENGVILFVVGCR...TVVTTWVLHLALSDLLASASLPFFTYFLAVG.SWELGTTFCKLHSSIFFLNMFASGFLLSAISLDRCLQVVRPVWAQNHRTVAAAHKVCLVLWALAVLNTVPYFVFR...........CYY.........DRDATCNSRQVALAVSKFLLAFLVPLAIIASSHAAVSLRLQHR....PGRFVRLVAAVVAAFALCWGPYHVFSLLEARA.....LRPLVWRGLPFVTSLAFFNSVANPVLYVLTCPDMLRKLRRSLRTVLES",
-			{26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, -1, -1, -1, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, -1, -1, 681, 682, 662, 663, 416, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, -1, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457}
+			{{0, 29, 26}, {32, 27, 55}, {59, 3, 372}, {62, 1, 415}, {64, 5, 279}, {69, 35, 98}, {104, 8, 284}, {112, 27, 375}, {150, 3, 292}, {162, 2, 681}, {164, 2, 662}, {166, 1, 416}, {167, 4, 402}, {171, 34, 295}, {209, 25, 206}, {234, 7, 339}, {246, 4, 411}, {250, 14, 346}, {264, 12, 237}, {276, 12, 360}, {288, 1, 418}, {289, 5, 453}}
 		}
 	},
 	{
@@ -2425,7 +2539,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			46, 301,
 			"ETSMHYILGMLIIVIGIISVSGNGVVMYLMMTVKNLRTPGNFLVLNLALSDFGMLFFMMPTMSINCFAETWVIGPFMCELYGMIGSLFGSASIWSLVMITLDRYNVIVKGMAGKPLTKVGALLRMLFVWIWSLGWTIAPMY.............CTI.....AINPMSYLIAYAIFVYFVPLFIIIYCYAFIVMQVAAHEKSLREQAKKMN......NEDNKKASAEFRLAKVAFMTICCWFMAWTPYLTLSFLGIFS.....TPMTSVWGAIFAKASACYNPIVYGISHPKYRAALHDKF",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, 580, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, 475, 596, 597, 598, 599, -1, -1, -1, -1, -1, -1, 595, 570, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371}
+			{{0, 33, 22}, {33, 4, 262}, {37, 27, 55}, {64, 3, 372}, {67, 1, 415}, {68, 1, 580}, {69, 5, 279}, {74, 35, 98}, {109, 7, 284}, {116, 25, 138}, {154, 3, 292}, {162, 3, 403}, {165, 40, 295}, {205, 2, 474}, {207, 4, 596}, {217, 1, 595}, {218, 1, 570}, {219, 1, 417}, {220, 4, 335}, {224, 27, 204}, {251, 7, 339}, {263, 14, 346}, {277, 12, 237}, {289, 12, 360}}
 		}
 	},
 	{
@@ -2433,7 +2547,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			196, 331,
 			"TNKEHREMHIYIAIFSSVTIFCTFFTLATFLADWKNSNRYPAVILFYVNACFFVGSIGWLA............................LSCVIIFIIVYYSMMSGVIWFVMLTYAWHTSFKALGT....LSGKTSYFHLITWSIPFVLTVAILAV...........CFV...NYHYRAGFVLAPIGLVLIGGGYFLIRGVMTLFSIKSNH........ASKINETMLRLGIFGFLAFGFVLITFGCHFYDFFNQAEWERSFREYVLCEANVTIAEQ..............SLLVEKINLFAMFGTGISMSTWVWTKATIIIWKRAWCRIL",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 518, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 683, 684, 685, -1, -1, -1, -1, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, 617, 618, 447, 448, 449, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, -1, -1, -1, -1, -1, -1, -1, -1, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, 409, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 686, 687, 688, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 635, 636, 637, 638, 639, 640, 641, 642, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455}
+			{{0, 33, 22}, {33, 1, 518}, {34, 4, 262}, {38, 23, 55}, {89, 34, 99}, {123, 3, 683}, {130, 26, 138}, {167, 3, 292}, {173, 2, 617}, {175, 6, 447}, {181, 30, 171}, {219, 1, 338}, {220, 27, 204}, {247, 7, 339}, {254, 4, 406}, {258, 16, 619}, {274, 3, 686}, {291, 8, 635}, {299, 16, 231}, {315, 12, 360}, {327, 1, 418}, {328, 3, 453}}
 		}
 	},
 	{
@@ -2441,7 +2555,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			28, 357,
 			"GGAGAAALVGGVLLIGLVLAGNSLVCVSVASERTLQTPTNYFIVSLAAADLLLAVLVLPLFVYSEVQG.VWLLSPRLCDTLMAMDVMLCTASIFNLCAISVDRFVAVTVPLRYNQQGQCQLLLIAATWLLSAAVASPVVCG...........CCL.NRDYVVYSSVCSFFLPCPLMLLLYWATFRGLRRWEAARHTKL.............................................................................AKITGRERKAMRVLPVVVGAFLVCWTPFFVVHITRALC.....SPRLVSAVTWLGYVNSALNPIIYTIFNAEFRSVFRKTLR",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 577, 578, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, 475, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 32, 23}, {32, 4, 262}, {36, 19, 55}, {55, 13, 266}, {69, 5, 279}, {74, 35, 98}, {109, 4, 284}, {113, 2, 577}, {115, 26, 375}, {152, 3, 292}, {156, 40, 295}, {196, 2, 474}, {275, 4, 335}, {279, 27, 204}, {306, 7, 339}, {318, 14, 346}, {332, 12, 237}, {344, 12, 360}, {356, 1, 418}}
 		}
 	},
 	{
@@ -2449,7 +2563,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			19, 299,
 			"SAGYTVLRILPLVVLGVTFVLGVLGNGLVIWVAGFRM..TVTTICYLNLALADFSFTATLPFLIVSMAMG.KWPFGWFLCKLIHIVVDINLFGSVFLIGFIALDRCICVLHPVWAQNHRTVSLAMKVIVGPWILALVLTLPVFLFL...........CTF.......TPEERLKVAITMLTARGIIRFVIGFSLPMSIVAICYGLIAAKIHKKG....SRPLRVLTAVVASFFICWFPFQLVALLGTVW.........YKIIDILVNPTSSLAFFNSCLNPMLYVFVGQDFRERLIHSL",
-			{19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 565, -1, -1, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, 689, 690, 691, 681, 682, 662, 663, 416, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, -1, -1, -1, -1, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371}
+			{{0, 36, 19}, {36, 1, 565}, {39, 27, 55}, {66, 3, 372}, {69, 1, 415}, {71, 5, 279}, {76, 35, 98}, {111, 8, 284}, {119, 27, 375}, {157, 3, 292}, {167, 3, 689}, {170, 2, 681}, {172, 2, 662}, {174, 1, 416}, {175, 4, 402}, {179, 35, 295}, {218, 24, 207}, {242, 7, 339}, {258, 3, 412}, {261, 14, 346}, {275, 12, 237}, {287, 12, 360}}
 		}
 	},
 	{
@@ -2457,7 +2571,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			31, 300,
 			"DAVYYSLGIFIGICGIIGCGGNGIVIYLFTKTKSLQTPANMFIINLAFSDFTFSLVNGFPLMTISCFLKKWIFGFAACKVYGFIGGIFGFMSIMTMAMISIDRYNVIGRPMAASKKMSHRRAFIMIIFVWLWSVLWAIGPIF.............CSF.....DSTTRSNILCMFILGFFGPILIIFFCYFNIVMSVSNHEKEMAAMAK...AKELRKAQAGANAEMRLAKISIVIVSQFLLSWSPYAVVALLAQFG.....TPYAAQLPVMFAKASAIHNPMIYSVSHPKFREAISQTF",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 692, 270, 271, 272, 273, 274, 275, 276, 277, 278, 693, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, 475, 596, -1, -1, -1, 654, 655, 656, 614, 595, 570, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371}
+			{{0, 32, 23}, {32, 4, 262}, {36, 22, 55}, {58, 1, 692}, {59, 9, 270}, {68, 1, 693}, {69, 5, 279}, {74, 35, 98}, {109, 8, 284}, {117, 25, 138}, {155, 3, 292}, {163, 3, 403}, {166, 40, 295}, {206, 2, 474}, {208, 1, 596}, {212, 3, 654}, {215, 1, 614}, {216, 1, 595}, {217, 1, 570}, {218, 1, 417}, {219, 4, 335}, {223, 27, 204}, {250, 7, 339}, {262, 14, 346}, {276, 12, 237}, {288, 12, 360}}
 		}
 	},
 	{
@@ -2465,7 +2579,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			38, 291,
 			"WVAPALSAVLIVTTAVDVVGNLLVILSVLRNRKLRNAGNLFLVSLALADLVVAFYPYPLILVAIFYDGWALGEEHCKASAFVMGLSVIGSVFNITAIAINRYCYICHSMAYHRIYRRWHTPLHICLIWLLTVVALLPNFFVG..........CTF....STQYTAAVVVIHFLLPIAVVSFCYLRIWVLVLQARRKA.....LCLKPSDLRSFLTMFVVFVIFAICWAPLNCIGLAVAIN........PEGLFVTSYLLAYFNSCLNAIVYGLLNQNFRREYKRILLALWN",
-			{24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456}
+			{{0, 31, 24}, {31, 4, 262}, {35, 19, 55}, {54, 18, 266}, {72, 35, 98}, {107, 8, 284}, {115, 27, 375}, {152, 3, 292}, {159, 38, 295}, {202, 4, 335}, {206, 27, 204}, {233, 7, 339}, {248, 14, 346}, {262, 12, 237}, {274, 12, 360}, {286, 1, 418}, {287, 4, 453}}
 		}
 	},
 	{
@@ -2473,7 +2587,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			41, 295,
 			"RSASSLALAIAITALYSAVCAVGLLGNVLVMFGIVRYTKLKTATNIYIFNLALADALATSTLPFQSAKYLMETWPFGELLCKAVLSIDYYNMFTSIFTLTMMSVDRYIAVCHPVKALDFRTPAKAKLINICIWVLASGVGVPIMVMA..........CML....PSWYWDTVTKICVFLFAFVVPILIITVCYGLMLLRLRSV.....SKEKDRSLRRITRMVLVVVGAFVVCWAPIHIFVIVWTLV.....DPLVVAALHLCIALGYANSSLNPVLYAFLDENFKRCFRQLCRT",
-			{419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, 416, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, -1, -1, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453}
+			{{0, 1, 419}, {1, 36, 19}, {37, 4, 262}, {41, 27, 55}, {68, 3, 372}, {71, 1, 415}, {72, 5, 279}, {77, 35, 98}, {112, 8, 284}, {120, 27, 138}, {157, 3, 292}, {164, 1, 416}, {165, 4, 402}, {169, 34, 295}, {208, 1, 417}, {209, 4, 335}, {213, 27, 204}, {240, 7, 339}, {252, 3, 412}, {255, 14, 346}, {269, 12, 237}, {281, 12, 360}, {293, 1, 418}, {294, 1, 453}}
 		}
 	},
 	{
@@ -2481,7 +2595,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			25, 286,
 			"FTDVLNQSKPVTLFLYGVVFLFGSIGNFLVIFTITWRRRIQCSGDVYFINLAAADLLFVCTLPLWMQYLLD....ASVPCTLLTACFYVAMFASLCFITEIALDRYYAIV.....PVKQACLFSIFWWIFAVIIAIPHFM........CMT.......SYPIILNVELMLGAFVIPLSVISYCYYRISRIVAVS...HKGRIVRVLIAVVLVFIIFWLPYHLTLFVDTLKLLK....SCEFERSLKRALILTESLAFCHCCLNPLLYVFVGTKFRQELHCLLAEFR",
-			{419, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, -1, -1, -1, -1, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, -1, -1, -1, -1, -1, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, -1, -1, -1, -1, 472, 473, 410, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455}
+			{{0, 1, 419}, {1, 36, 19}, {37, 4, 262}, {41, 27, 55}, {68, 3, 372}, {75, 1, 283}, {76, 34, 98}, {115, 25, 375}, {148, 3, 292}, {158, 2, 404}, {160, 34, 295}, {197, 26, 205}, {223, 7, 339}, {230, 3, 406}, {237, 2, 472}, {239, 5, 410}, {244, 14, 346}, {258, 12, 237}, {270, 12, 360}, {282, 1, 418}, {283, 3, 453}}
 		}
 	},
 	{
@@ -2489,7 +2603,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			228, 311,
 			"SADERTFATFWIGLWSVLCFISTSTTVATFLIDMERFRYPERPIIFLSACYLCVSLGFLVRLVVG.....................LCTIVFLLVYFFGMASSIWWVILSLTWFLAAGMK.GNEAIAGYAQYFHLAAWLIPSVKSITALALS..........CYV...NLNSLRGFVLGPLVLYLLVGTLFLLAGFVSLFRIRSVI..........EKLMIRIGIFTLLYTVPASIVVACYLYEQHYRESWE...................EYWVLMLKYFMCLVVGITSGVWIWSGKTVESWRRFTSRCC",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 518, 262, 263, 264, 265, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 683, -1, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, 617, 618, 447, 448, 449, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, 409, 619, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 635, 636, 637, 638, 639, 640, 641, 642, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455}
+			{{0, 33, 22}, {33, 1, 518}, {34, 4, 262}, {38, 26, 56}, {64, 1, 372}, {86, 33, 100}, {119, 1, 683}, {121, 31, 134}, {162, 3, 292}, {168, 2, 617}, {170, 6, 447}, {176, 30, 171}, {216, 24, 207}, {240, 7, 339}, {247, 4, 406}, {251, 1, 619}, {271, 8, 635}, {279, 16, 231}, {295, 12, 360}, {307, 1, 418}, {308, 3, 453}}
 		}
 	},
 	{
@@ -2497,7 +2611,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			227, 331,
 			"TEAEHQDMHSYIAAFGAVTGLCTLFTLATFVADWRNSNRYPAVILFYVNACFFVGSIGWLAQF..........................LSCVIIFVIVYYALMAGVVWFVVLTYAWHTSFKA..........KTSYFHLLTWSLPFVLTVAILAVA..........CFV...NYRYRAGFVLAPIGLVLIVGGYFLIRGVMTLFSIKSNH....SEKAASKINETMLRLGIFGFLAFGFVLITFSCHFYDFFNQAEWERSFRDYVLCQANVTI.................SLLVEKINLFAMFGTGIAMSTWVWTKATLLIWRRTWCRLT",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 518, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, 617, 618, 447, 448, 449, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, -1, -1, -1, -1, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, 409, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 635, 636, 637, 638, 639, 640, 641, 642, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455}
+			{{0, 33, 22}, {33, 1, 518}, {34, 4, 262}, {38, 25, 55}, {89, 34, 99}, {133, 24, 141}, {167, 3, 292}, {173, 2, 617}, {175, 6, 447}, {181, 30, 171}, {215, 1, 417}, {216, 4, 335}, {220, 27, 204}, {247, 7, 339}, {254, 4, 406}, {258, 16, 619}, {291, 8, 635}, {299, 16, 231}, {315, 12, 360}, {327, 1, 418}, {328, 3, 453}}
 		}
 	},
 	{
@@ -2505,7 +2619,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			137, 295,
 			"PEEQLLSLYIIYTVGYALSFSALVIASAILLGFRHLHCTRNYIHLNLFASFILRALSVFIKDAALKWMYSTAAQQ............LGCRLVFLLMQYCVAANYYWLLVEGAYLYTLLAF...SEQRIFKLYLSIGWGVPLLFVIPWGIVKYLYE...CWT...NMNYWLIIRLPILFAIGVNFLIFIRVICIVVSKLKA........KCRLAKSTLTLIPLLGTHEVIFAF.........LRFVKLFTELSFTSFQGLMVAILYCFVNNEVQMEFRKSWERWRLEHLRVQRDS",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, 580, 581, 694, 695, 696, 697, 698, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, 582, 583, 584, 585, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 586, -1, -1, -1, 292, 293, 294, -1, -1, -1, 618, 447, 448, 449, 450, 451, 452, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, -1, -1, -1, -1, -1, -1, -1, -1, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, -1, -1, -1, -1, -1, -1, -1, -1, -1, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465}
+			{{0, 33, 22}, {33, 4, 262}, {37, 27, 55}, {64, 3, 372}, {67, 1, 415}, {68, 2, 580}, {70, 5, 694}, {87, 34, 99}, {124, 4, 582}, {128, 27, 420}, {155, 1, 586}, {159, 3, 292}, {165, 1, 618}, {166, 6, 447}, {172, 29, 171}, {209, 24, 206}, {242, 1, 414}, {243, 14, 346}, {257, 12, 237}, {269, 12, 360}, {281, 1, 418}, {282, 13, 453}}
 		}
 	},
 	{
@@ -2513,7 +2627,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			39, 304,
 			"PAPLLAGVTATCVALFVVGIAGNLLTMLVVSRFRELRTTTNLYLSSMAFSDLLIFLCMPLDLVRLWQY.PWNFGDLLCKLFQFVSESCTYATVLTITALSVERYFAICFPLRAKVVVTKGRVKLVIFVIWAVAFCSAGPIFVLV...............CRP.......GLLTVMVWVSSIFFFLPVFCLTVLYSLIGRKLWRRRRGD.....SLRDQNHKQTVKMLAVVVFAFILCWLPFHVGRYLFSKS........AQISQYCNLVSFVLFYLSAAINPILYNIMSKKYRVAVFRLLGFEP",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, 568, 569, 466, 467, 468, 469, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, -1, -1, -1, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455}
+			{{0, 33, 22}, {33, 4, 262}, {37, 27, 55}, {64, 3, 372}, {67, 1, 415}, {69, 5, 279}, {74, 35, 98}, {109, 8, 284}, {117, 27, 375}, {159, 3, 292}, {169, 2, 568}, {171, 4, 466}, {175, 33, 168}, {213, 4, 335}, {217, 27, 204}, {244, 7, 339}, {259, 3, 412}, {262, 14, 346}, {276, 12, 237}, {288, 12, 360}, {300, 1, 418}, {301, 3, 453}}
 		}
 	},
 	{
@@ -2521,7 +2635,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			48, 411,
 			"TLTLVCLAGLLMLLTVFGNVLVIIAVFTSRALKAPQNLFLVSLASADILVATLVIPFSLANEVMGYWYFGKAWCEIYLALDVLFCTSSIVHLCAISLDRYWSITQAIEYNLKRTPRRIKAIIITVWVISAVISFPPLI.................CEI..QKWYVISSCIGSFFAPCLIMILVYVRIYQIAKRRTRVPPSR.................................................................................................................................RGRQNREKRFTFVLAVVIGVFVVCWFPFFFTYTLTAVG...PRTLFKFFFWFGYCNSSLNPVIYTIFNHDFRRAFKKILCR",
-			{26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453}
+			{{0, 29, 26}, {29, 4, 262}, {33, 19, 55}, {52, 18, 266}, {70, 35, 98}, {105, 8, 284}, {113, 25, 138}, {155, 3, 292}, {160, 40, 295}, {200, 1, 474}, {330, 4, 335}, {334, 27, 204}, {361, 7, 339}, {371, 14, 346}, {385, 12, 237}, {397, 12, 360}, {409, 1, 418}, {410, 1, 453}}
 		}
 	},
 	{
@@ -2529,7 +2643,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			13, 284,
 			"GVEFISLLAIILLSVALAVGLPGNSFVVWSILKRMQKRSVTALMVLNLALADLAVLLTAPFFLHFLAQGTWSFGLAGCRLCHYVCGVSMYASVLLITAMSLDRSLAVARPFVSQKLRTKAMARRVLAGIWVLSFLLATPVLAYR...........CFP...SEGHRAFHLIFEAVTGFLLPFLAVVASYSDIGRRLQAR....SRRTGRLVVLIILTFAAFWLPYHVVNLAEAGRALA........VGKRLSLARNVLIALAFLSSSVNPVLYACAGGGLLRSA",
-			{21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 372, 373, 374, 415, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, -1, -1, -1, -1, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, 407, 408, -1, -1, -1, -1, -1, -1, -1, -1, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256}
+			{{0, 34, 21}, {34, 4, 262}, {38, 27, 55}, {65, 3, 372}, {68, 1, 415}, {69, 5, 279}, {74, 35, 98}, {109, 8, 284}, {117, 27, 375}, {155, 3, 292}, {161, 4, 402}, {165, 34, 295}, {203, 25, 206}, {228, 7, 339}, {235, 3, 406}, {246, 4, 411}, {250, 14, 346}, {264, 20, 237}}
 		}
 	},
 	{
@@ -2537,7 +2651,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			47, 407,
 			"SAGAVAGLAAVVGFLIVFTVVGNVLVVIAVLTSRALRAPQNLFLVSLASADILVATLVMPFSLANELMAYWYFGQVWCGVYLALDVLFCTSSIVHLCAISLDRYWSVTQAVEYNLKRTPRRVKATIVAVWLISAVISFPPLV.............CGL..ETWYILSSCIGSFFAPCLIMGLVYARIYRVAKLRTRTLSEK...........................................................................................................................KVAQAREKRFTFVLAVVMGVFVLCWFPFFFSYSLYGICR.....PGPLFKFFFWIGYCNSSLNPVIYTVFNQDFRRSFKHILF",
-			{22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, 288, 289, 290, 291, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 474, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, 406, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418}
+			{{0, 33, 22}, {33, 4, 262}, {37, 19, 55}, {56, 18, 266}, {74, 35, 98}, {109, 8, 284}, {117, 25, 138}, {155, 3, 292}, {160, 40, 295}, {200, 1, 474}, {324, 4, 335}, {328, 27, 204}, {355, 7, 339}, {362, 1, 406}, {368, 14, 346}, {382, 12, 237}, {394, 12, 360}, {406, 1, 418}}
 		}
 	},
 	{
@@ -2545,7 +2659,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			32, 296,
 			"TLSGKIRVTVTFFLFLLSATFNASFLLKLQKW.......KKLSRMKLLLKHLTLANLLETLIVMPLDGMWN...QWYAGELLCKVLSYLKLFSMYAPAFMMVVISLDRSLAITRPLAL..NSKVGQSMVGLAWILSSVFAGPQLYIF.................CVT.....QWWHQAFYNFFTFSCLFIIPLFIMLICNAKIIFTLTRVLHQDPH.....QSKNNIPRARLKTLKMTVAFATSFTVCWTPYYVLGIWYWFD.......SDPVNHFFFLFAFLNPCFDPLIYGYFS",
-			{23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, -1, -1, -1, -1, -1, -1, -1, 262, 263, 264, 265, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, -1, -1, -1, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 284, 285, 286, 287, -1, -1, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, 402, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, -1, -1, -1, -1, -1, 595, 570, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, -1, -1, -1, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249}
+			{{0, 32, 23}, {39, 4, 262}, {43, 18, 56}, {61, 10, 266}, {74, 5, 279}, {79, 35, 98}, {114, 4, 284}, {120, 27, 375}, {164, 3, 292}, {172, 4, 402}, {176, 40, 295}, {221, 1, 595}, {222, 1, 570}, {223, 1, 417}, {224, 4, 335}, {228, 27, 204}, {255, 7, 339}, {269, 14, 346}, {283, 13, 237}}
 		}
 	},
 	{
@@ -2553,7 +2667,7 @@ map<string, tuple<int, int, string, vector<short>>> numbering_data =
 		{
 			48, 298,
 			"EVQVVLILAYCSIILLGVIGNSLVIHVVIKFKSMRTVTNFFIANLAVADLLVNTLCLPFTLTYTLMGEWKMGPVLCHLVPYAQGLAVQVSTITLTVIALDRHRCIVY......SKRISFLIIGLAWGISALLASPLAIFR...............CTE.......SIYGTVYSLSSLLILYVLPLGIISFSYTRIWSKLKNHVSPG..NDHYHQRRQKTTKMLVCVVVVFAVSWLPLHAFQLAVDID....DLKEYKLIFTVFHIIAMCSTFANPLLYGWMNSNYRKAFLSAFRCEQR",
-			{24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 262, 263, 264, 265, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, -1, -1, -1, -1, -1, -1, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 292, 293, 294, -1, -1, -1, -1, -1, -1, -1, 403, 404, 405, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, -1, -1, 417, 335, 336, 337, 338, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 339, 340, 341, 342, 343, 344, 345, -1, -1, -1, -1, 411, 412, 413, 414, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 418, 453, 454, 455, 456}
+			{{0, 31, 24}, {31, 4, 262}, {35, 19, 55}, {54, 18, 266}, {72, 35, 98}, {113, 27, 375}, {155, 3, 292}, {165, 3, 403}, {168, 38, 295}, {208, 1, 417}, {209, 4, 335}, {213, 27, 204}, {240, 7, 339}, {251, 4, 411}, {255, 14, 346}, {269, 12, 237}, {281, 12, 360}, {293, 1, 418}, {294, 4, 453}}
 		}
 	},
 };
@@ -5,8 +5,11 @@
 #include <tuple>
 using namespace std;
 
+// date of the GPCRdb snapshot
+extern string gpcrdb_version;
+
 // string_index => string
-extern array<string, 699> string_table;
+extern vector<string> string_table;
 
 // scheme_index => scheme_numbering_offset, scheme_numbering_length, scheme_names
 extern array<tuple<size_t, size_t, vector<string>>, 12> schemes;
@@ -14,6 +17,9 @@ extern array<tuple<size_t, size_t, vector<string>>, 12> schemes;
 // uniprot_id => [symbol, species, gene_name, long_species]
 extern map<string, tuple<string, string, string, string>> uniprot_dict;
 
+// uniprot_id => class
+extern map<string, string> class_dict;
+
 // symbol => uniprot_id
 extern multimap<string, string> symbol_dict;
 
@@ -26,5 +32,5 @@ extern multimap<string, string> gene_name_dict;
 // pdb_id => uniprot_id
 extern map<string, string> pdb_id_dict;
 
-// uniprot_id => [low, length, string_table_index...]
-extern map<string, tuple<int, int, string, vector<short>>> numbering_data;
+// uniprot_id => [low, length, residues, runs of [offset, count, first_string_table_index]...]
+extern map<string, tuple<int, int, string, vector<array<short, 3>>>> numbering_data;
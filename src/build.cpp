@@ -0,0 +1,332 @@
+// gpcrn-build compiles the per-receptor GPCRdb caches written by GenerateAssets (dbcache/*.json) into the gpcrn
+// database, either as assets.hpp and assets.cpp sources or as a binary database for gpcrn --database.
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <map>
+#include <set>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <thread>
+#include <atomic>
+#include <filesystem>
+#include <boost/program_options.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include "string.hpp"
+#include "delta.hpp"
+#include "database.hpp"
+#include "numbering.hpp"
+using namespace std;
+using namespace std::filesystem;
+using namespace boost::program_options;
+using boost::property_tree::ptree;
+
+// the numbering of one receptor as cached by GenerateAssets
+struct receptor_cache
+{
+	string uid;
+	path file;
+	map<int, char> residues;         // seq => one-letter residue name
+	map<int, vector<string>> labels; // seq => one label per scheme
+	string error;
+};
+
+static int to_seq(const string& key)
+{
+	size_t n = 0;
+	int seq = 0;
+	try
+	{
+		seq = stoi(key, &n);
+	}
+	catch (exception&)
+	{
+	}
+	if (key.empty() || n != key.size())
+		throw runtime_error("invalid residue number '" + key + "'");
+	return seq;
+}
+
+// labels end up inside C++ string literals and fixed-width columns
+static bool is_plain(const string& label)
+{
+	return all_of(label.begin(), label.end(), [](char c) { return isprint((unsigned char)c) && c != '"' && c != '\\'; });
+}
+
+// {"Item1":{"<seq>":"<residue>",...},"Item2":{"<seq>":["<label>",...],...}}
+static void load_cache(size_t scheme_count, receptor_cache& r)
+{
+	try
+	{
+		ptree tree;
+		read_json(r.file.string(), tree);
+
+		for (auto& [key, value] : tree.get_child("Item1"))
+		{
+			auto name = value.get_value<string>();
+			if (name.size() != 1 || !isalpha((unsigned char)name[0]))
+				throw runtime_error("residue " + key + " is '" + name + "' rather than a one-letter code");
+			r.residues[to_seq(key)] = (char)toupper(name[0]);
+		}
+
+		for (auto& [key, value] : tree.get_child("Item2"))
+		{
+			auto& labels = r.labels[to_seq(key)];
+			for (auto& [ignore, label] : value)
+				labels.push_back(trim(label.get_value<string>()));
+			if (labels.size() != scheme_count)
+				throw runtime_error("residue " + key + " has " + to_string(labels.size()) + " labels for " + to_string(scheme_count) + " schemes");
+			for (auto& label : labels)
+				if (!is_plain(label))
+					throw runtime_error("residue " + key + " has an unprintable label");
+		}
+	}
+	catch (exception& ex)
+	{
+		r.error = r.file.string() + ": " + ex.what();
+	}
+}
+
+// the labels of a receptor already in the database, for receptors without a cache file
+static receptor_cache from_database(const string& uid, const receptor_numbering& numbering)
+{
+	auto& t = tables();
+	receptor_cache r;
+	r.uid = uid;
+	auto& [low, length, residues, runs] = numbering;
+	for (int i = 0; i < length; i++)
+		if (residues[i] != '.')
+			r.residues[low + i] = residues[i];
+
+	for_each_residue(numbering, [&](int seq, int index, char)
+	{
+		auto& labels = r.labels[seq];
+		for (auto& [offset, width, names] : t.schemes)
+			labels.push_back(trim(t.string_table[index].substr(offset, width)));
+	});
+	return r;
+}
+
+// names[0] is the full name, names[1] the GPCRdb short name and names[2] the initials if they differ, as in GenerateAssets
+static vector<string> scheme_names(const string& name, string short_name)
+{
+	string upper = name, initials;
+	transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+	for (auto& word : split(upper, string(" ()-")))
+		if (word.size() && word != "CLASS" && word != "SCHEME")
+			initials += word[0];
+
+	short_name.erase(remove_if(short_name.begin(), short_name.end(), [](char c) { return c == '(' || c == ')'; }), short_name.end());
+	if (initials == short_name)
+		return { name, short_name };
+	return { name, short_name, initials };
+}
+
+int main(int argc, char* argv[])
+{
+	try
+	{
+		path cache_dir, source_dir, binary_file;
+		vector<path> deltas;
+		string version;
+		unsigned threads;
+
+		options_description options("Options");
+		options.add_options()
+			("cache,c", value<path>(&cache_dir)->value_name("DIR")->default_value("dbcache"), "the directory of headers.json and <uniprot_id>.json files written by GenerateAssets")
+			("delta", value<vector<path>>(&deltas)->value_name("FILE"), "apply a delta file before building, e.g. to add the receptors and pdb ids of new caches; may be repeated")
+			("gpcrdb-version", value<string>(&version)->value_name("DATE"), "the GPCRdb snapshot date to record; defaults to the built-in one")
+			("source", value<path>(&source_dir)->value_name("DIR"), "write assets.hpp and assets.cpp into DIR")
+			("binary", value<path>(&binary_file)->value_name("FILE"), "write a binary database for gpcrn --database")
+			("threads,j", value<unsigned>(&threads)->value_name("N")->default_value(thread::hardware_concurrency()), "the number of threads parsing cache files")
+			("help", "this help information")
+			;
+
+		variables_map vm;
+		store(parse_command_line(argc, argv, options), vm);
+		notify(vm);
+
+		if (vm.count("help") || (!vm.count("source") && !vm.count("binary")))
+		{
+			cout << "Usage: " << argv[0] << " [--cache <dir>] [--delta <file> ...] (--source <dir> | --binary <file>) [options]" << endl;
+			cout << "Builds the gpcrn database from the GPCRdb caches of GenerateAssets on top of the built-in receptors" << endl;
+			cout << options << endl;
+			return vm.count("help") ? 0 : 2;
+		}
+
+		for (auto& delta : deltas)
+		{
+			ifstream in(delta);
+			if (!in)
+			{
+				cerr << "ERROR: cannot open delta file '" << delta.string() << "'" << endl;
+				return 2;
+			}
+			apply_delta(in, delta.string());
+		}
+
+		if (!is_directory(cache_dir))
+		{
+			cerr << "ERROR: cannot find cache directory '" << cache_dir.string() << "'" << endl;
+			return 2;
+		}
+
+		// scheme names, if the headers were cached
+		vector<vector<string>> names;
+		auto header_file = cache_dir / "headers.json";
+		if (exists(header_file))
+		{
+			ptree tree;
+			read_json(header_file.string(), tree);
+			for (auto& [ignore, header] : tree)
+				names.push_back(scheme_names(header.get<string>("Item1"), header.get<string>("Item2")));
+			if (names.size() != scheme_count)
+			{
+				cerr << "ERROR: " << header_file.string() << " lists " << names.size() << " schemes but gpcrn is compiled for " << scheme_count << endl;
+				return 2;
+			}
+		}
+
+		// every file but headers.json holds one receptor
+		vector<receptor_cache> caches;
+		for (auto& entry : directory_iterator(cache_dir))
+		{
+			auto& file = entry.path();
+			if (file.extension() == ".json" && file.filename() != "headers.json")
+			{
+				auto& c = caches.emplace_back();
+				c.file = file;
+				c.uid = file.stem().string();
+				transform(c.uid.begin(), c.uid.end(), c.uid.begin(), ::toupper);
+			}
+		}
+		sort(caches.begin(), caches.end(), [](auto& a, auto& b) { return a.uid < b.uid; });
+
+		// parse the files on a pool of threads taking the next file from a shared counter
+		atomic<size_t> next{ 0 };
+		auto work = [&]
+		{
+			for (size_t i; (i = next++) < caches.size();)
+				load_cache(scheme_count, caches[i]);
+		};
+		vector<thread> workers;
+		for (unsigned t = 0; t < max(1u, threads); t++)
+			workers.emplace_back(work);
+		for (auto& w : workers)
+			w.join();
+
+		// validate before touching the tables, which are rebuilt in a copy
+		auto t = loaded_tables();
+		int errors = 0;
+		for (auto& c : caches)
+		{
+			if (c.error.empty() && !t.uniprot_dict.count(c.uid))
+				c.error = c.uid + ": unknown receptor; add it with a 'receptor' line in a delta file";
+			if (c.error.empty() && c.labels.empty())
+				c.error = c.uid + ": no numbered residues";
+			if (c.error.size())
+			{
+				cerr << "ERROR: " << c.error << endl;
+				++errors;
+			}
+		}
+		if (errors)
+			return 2;
+
+		// receptors without a cache file keep their current numbering
+		set<string> uids;
+		for (auto& c : caches)
+			uids.insert(c.uid);
+		size_t cached = caches.size();
+		for (auto& [uid, numbering] : t.numbering_data)
+			if (uids.insert(uid).second)
+				caches.push_back(from_database(uid, numbering));
+		sort(caches.begin(), caches.end(), [](auto& a, auto& b) { return a.uid < b.uid; });
+
+		for (auto& [uid, entry] : t.uniprot_dict)
+			if (!uids.count(uid))
+				cerr << "WARNING: no numbering for receptor '" << uid << "'" << endl;
+
+		// each scheme column is as wide as its longest label
+		vector<size_t> widths(t.schemes.size());
+		for (auto& c : caches)
+			for (auto& [seq, labels] : c.labels)
+				for (size_t s = 0; s < labels.size(); s++)
+					widths[s] = max(widths[s], labels[s].size());
+
+		size_t offset = 0;
+		for (size_t s = 0; s < t.schemes.size(); s++)
+		{
+			auto& [scheme_offset, scheme_width, scheme_names] = t.schemes[s];
+			scheme_offset = offset;
+			scheme_width = widths[s];
+			if (names.size())
+				scheme_names = names[s];
+			offset += widths[s];
+		}
+
+		// rows are deduplicated in receptor and sequence order
+		vector<string> table;
+		unordered_map<string, short> row_ids;
+		decltype(t.numbering_data) numberings;
+		for (auto& c : caches)
+		{
+			int low = c.labels.begin()->first, length = c.labels.rbegin()->first - low + 1;
+			if (length > 32767)
+			{
+				cerr << "ERROR: " << c.uid << ": " << length << " residues exceed the numbering range" << endl;
+				return 2;
+			}
+
+			string residues(length, '.');
+			vector<short> indices(length, -1);
+			for (auto& [seq, labels] : c.labels)
+			{
+				string row;
+				for (size_t s = 0; s < labels.size(); s++)
+					row += pad_right(string(labels[s]), widths[s], ' ');
+
+				auto [it, added] = row_ids.emplace(row, (short)table.size());
+				if (added)
+				{
+					if (table.size() == 32767)
+					{
+						cerr << "ERROR: more than 32767 distinct numbering rows" << endl;
+						return 2;
+					}
+					table.push_back(row);
+				}
+				indices[seq - low] = it->second;
+
+				auto res = c.residues.find(seq);
+				if (res != c.residues.end())
+					residues[seq - low] = res->second;
+			}
+			numberings[c.uid] = { low, length, residues, encode_runs(indices) };
+		}
+
+		t.string_table.swap(table);
+		t.numbering_data.swap(numberings);
+		if (version.size())
+			t.version = version;
+		use_tables(move(t));
+
+		if (vm.count("source"))
+		{
+			create_directories(source_dir);
+			write_assets(source_dir);
+		}
+		if (vm.count("binary"))
+			write_database(binary_file);
+
+		cout << tables().numbering_data.size() << " receptors (" << cached << " from " << cache_dir.string() << "), "
+			<< tables().string_table.size() << " numbering rows, " << offset << " columns" << endl;
+		return 0;
+	}
+	catch (exception& ex)
+	{
+		cerr << "ERROR: " << ex.what() << endl;
+		return 2;
+	}
+}
@@ -0,0 +1,107 @@
+#include <ostream>
+#include "cache.hpp"
+#include "string.hpp"
+using namespace std;
+
+result_cache::result_cache(size_t capacity) : shard_capacity(capacity / 16)
+{
+}
+
+// the key is stored twice, in the list and in the index, next to some bookkeeping
+size_t result_cache::cost(const string& key, const cached_result& result)
+{
+	return key.size() * 2 + result.bytes.size() + result.messages.size() + result.spelling.size() + 128;
+}
+
+result_cache::shard& result_cache::shard_of(const string& key)
+{
+	return shards[hash<string>()(key) % shards.size()];
+}
+
+shared_ptr<const cached_result> result_cache::get(const string& key)
+{
+	auto& s = shard_of(key);
+	lock_guard<mutex> guard(s.lock);
+
+	auto it = s.index.find(key);
+	if (it == s.index.end())
+	{
+		++miss_count;
+		return nullptr;
+	}
+
+	++hit_count;
+	s.entries.splice(s.entries.begin(), s.entries, it->second);
+	return it->second->second;
+}
+
+void result_cache::put(const string& key, shared_ptr<const cached_result> result)
+{
+	auto c = cost(key, *result);
+	if (c > shard_capacity)
+		return;
+
+	auto& s = shard_of(key);
+	lock_guard<mutex> guard(s.lock);
+
+	auto it = s.index.find(key);
+	if (it != s.index.end())
+	{
+		s.bytes -= cost(key, *it->second->second);
+		s.entries.erase(it->second);
+		s.index.erase(it);
+	}
+
+	while (s.bytes + c > shard_capacity)
+	{
+		auto& [old_key, old_result] = s.entries.back();
+		s.bytes -= cost(old_key, *old_result);
+		s.index.erase(old_key);
+		s.entries.pop_back();
+	}
+
+	s.entries.emplace_front(key, move(result));
+	s.index.emplace(key, s.entries.begin());
+	s.bytes += c;
+}
+
+size_t result_cache::size() const
+{
+	size_t n = 0;
+	for (auto& s : shards)
+	{
+		lock_guard<mutex> guard(s.lock);
+		n += s.index.size();
+	}
+	return n;
+}
+
+size_t result_cache::bytes() const
+{
+	size_t n = 0;
+	for (auto& s : shards)
+	{
+		lock_guard<mutex> guard(s.lock);
+		n += s.bytes;
+	}
+	return n;
+}
+
+void result_cache::clear()
+{
+	for (auto& s : shards)
+	{
+		lock_guard<mutex> guard(s.lock);
+		s.index.clear();
+		s.entries.clear();
+		s.bytes = 0;
+	}
+}
+
+void result_cache::write_stats(ostream& out) const
+{
+	auto total = hits() + misses();
+	out << "INFO: cache: " << hits() << " hits, " << misses() << " misses ("
+		<< to_fixed(total ? 100.0 * hits() / total : 0, 1) << "% hit rate), "
+		<< size() << " entries, " << bytes() << " bytes" << endl;
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+using namespace std;
+
+//! The formatted output of one query.
+struct cached_result
+{
+	string bytes;    // output lines without the header
+	int rows = 0;    // number of lines in bytes
+	string messages; // warnings written to stderr along with the output, such as a fuzzy match of the target
+	string spelling; // the query as typed if the messages or the output quote its target, the only spelling it answers
+};
+
+//! A bounded, thread-safe LRU cache of query results keyed on normalized queries.
+//! Keys are spread over independently locked shards so that concurrent lookups rarely contend.
+class result_cache
+{
+public:
+	//! Creates a cache holding up to capacity bytes of keys and results in total.
+	explicit result_cache(size_t capacity);
+
+	//! Returns the cached result of a key, or nullptr on a miss.
+	shared_ptr<const cached_result> get(const string& key);
+
+	//! Stores a result, evicting the least recently used ones of its shard to stay within the capacity.
+	void put(const string& key, shared_ptr<const cached_result> result);
+
+	//! Drops every result, as when the tables they came from are replaced.
+	void clear();
+
+	//! The most bytes of keys and results one result may take up; larger ones are not stored.
+	size_t largest() const { return shard_capacity; }
+
+	size_t hits() const { return hit_count; }
+	size_t misses() const { return miss_count; }
+	size_t size() const;
+	size_t bytes() const;
+
+	//! Reports the hits, misses, hit rate and size on one line.
+	void write_stats(ostream& out) const;
+
+private:
+	struct shard
+	{
+		mutable mutex lock;
+		list<pair<string, shared_ptr<const cached_result>>> entries; // most recently used first
+		unordered_map<string, decltype(entries)::iterator> index;
+		size_t bytes = 0;
+	};
+
+	static size_t cost(const string& key, const cached_result& result);
+	shard& shard_of(const string& key);
+
+	array<shard, 16> shards;
+	size_t shard_capacity;
+	atomic<size_t> hit_count{ 0 }, miss_count{ 0 };
+};
@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+#include "database.hpp"
+#include "complete.hpp"
+#include "string.hpp"
+using namespace std;
+
+static string fold(string s)
+{
+	transform(s.begin(), s.end(), s.begin(), ::tolower);
+	return s;
+}
+
+void prefix_index::add(const string& key)
+{
+	keys.emplace_back(fold(key), key);
+}
+
+void prefix_index::build()
+{
+	sort(keys.begin(), keys.end());
+	keys.erase(unique(keys.begin(), keys.end(), [](auto& a, auto& b) { return a.first == b.first; }), keys.end());
+}
+
+vector<string> prefix_index::complete(const string& prefix, size_t limit) const
+{
+	vector<string> results;
+	auto folded = fold(prefix);
+	auto it = lower_bound(keys.begin(), keys.end(), folded, [](auto& a, auto& b) { return a.first < b; });
+	for (; it != keys.end() && results.size() < limit && starts_with(it->first, folded); ++it)
+		results.push_back(it->second);
+	return results;
+}
+
+static const prefix_index& target_index()
+{
+	static table_cache<prefix_index> index;
+	return index.get([]
+	{
+		auto& t = tables();
+		prefix_index idx;
+		for (auto& [key, ignore] : t.uniprot_dict)
+			idx.add(key);
+		for (auto& [key, ignore] : t.gene_name_dict)
+			idx.add(key);
+		for (auto& [key, ignore] : t.symbol_dict)
+			idx.add(key);
+		for (auto& [key, ignore] : t.symbol_species_dict)
+			idx.add(key);
+		for (auto& [key, ignore] : t.pdb_id_dict)
+			idx.add(key);
+		idx.build();
+		return idx;
+	});
+}
+
+static const prefix_index& label_index(int scheme_id)
+{
+	static table_cache<array<prefix_index, scheme_count>> indices;
+	return indices.get([]
+	{
+		auto& t = tables();
+		array<prefix_index, scheme_count> idx;
+		for (size_t i = 0; i < t.schemes.size(); i++)
+		{
+			auto [offset, width, names] = t.schemes[i];
+			for (auto& row : t.string_table)
+			{
+				auto label = trim(row.substr(offset, width));
+				if (!label.empty())
+					idx[i].add(label);
+			}
+			idx[i].build();
+		}
+		return idx;
+	})[scheme_id];
+}
+
+vector<string> complete_query(const string& word, int scheme_id, size_t limit)
+{
+	auto colon = word.find(':');
+
+	// still typing the target, complete it up to the colon
+	if (colon == string::npos)
+	{
+		auto results = target_index().complete(word, limit);
+		for (auto& s : results)
+			s.push_back(':');
+		return results;
+	}
+
+	auto target = word.substr(0, colon + 1);
+	auto results = label_index(scheme_id).complete(word.substr(colon + 1), limit);
+	for (auto& s : results)
+		s.insert(0, target);
+	return results;
+}
+
+string completion_script(const string& shell, const string& program, const set<string>& listings)
+{
+	auto& t = tables();
+	string scheme_names, listing_names = join(" ", listings.begin(), listings.end());
+	for (auto& [offset, width, names] : t.schemes)
+		for (size_t i = 1; i < names.size(); i++)
+			scheme_names += (scheme_names.empty() ? "" : " ") + names[i];
+
+	ostringstream out;
+	if (shell == "bash")
+	{
+		out << "# bash completion for gpcrn; load with: source <(" << program << " --completion bash)" << endl;
+		out << "_gpcrn()" << endl;
+		out << "{" << endl;
+		out << "\tlocal line=${COMP_LINE:0:$COMP_POINT}" << endl;
+		out << "\tlocal word=${line##*[[:space:]]} prev=${COMP_WORDS[COMP_CWORD-1]} scheme=BW i" << endl;
+		out << "\tfor ((i = 1; i < COMP_CWORD; i++)); do" << endl;
+		out << "\t\tcase ${COMP_WORDS[i]} in -s|--scheme) scheme=${COMP_WORDS[i+1]} ;; -s?*) scheme=${COMP_WORDS[i]#-s} ;; esac" << endl;
+		out << "\tdone" << endl;
+		out << "\tcase $prev in" << endl;
+		out << "\t-s|--scheme) COMPREPLY=($(compgen -W \"" << scheme_names << "\" -- \"$word\")); return ;;" << endl;
+		out << "\t-L|--list) COMPREPLY=($(compgen -W \"" << listing_names << "\" -- \"$word\")); return ;;" << endl;
+		out << "\t-f|--file) COMPREPLY=($(compgen -f -- \"$word\")); return ;;" << endl;
+		out << "\tesac" << endl;
+		out << "\t[[ $word == -* ]] && return" << endl;
+		out << "\tCOMPREPLY=($(" << program << " --complete \"$word\" --scheme \"$scheme\" 2>/dev/null))" << endl;
+		out << "\t# bash treats ':' as a word break, so only the part after the last colon is replaced" << endl;
+		out << "\tlocal colon_prefix=${word%\"${word##*:}\"}" << endl;
+		out << "\tCOMPREPLY=(\"${COMPREPLY[@]#\"$colon_prefix\"}\")" << endl;
+		out << "\t[[ ${#COMPREPLY[@]} -eq 1 && $word != *:* ]] && compopt -o nospace" << endl;
+		out << "}" << endl;
+		out << "complete -F _gpcrn gpcrn" << endl;
+	}
+	else if (shell == "zsh")
+	{
+		out << "#compdef gpcrn" << endl;
+		out << "# zsh completion for gpcrn; load with: source <(" << program << " --completion zsh)" << endl;
+		out << "_gpcrn()" << endl;
+		out << "{" << endl;
+		out << "\tlocal scheme=BW i" << endl;
+		out << "\tfor ((i = 2; i < CURRENT; i++)); do" << endl;
+		out << "\t\tcase ${words[i]} in -s|--scheme) scheme=${words[i+1]} ;; -s?*) scheme=${words[i]#-s} ;; esac" << endl;
+		out << "\tdone" << endl;
+		out << "\tcase ${words[CURRENT-1]} in" << endl;
+		out << "\t-s|--scheme) compadd -- " << scheme_names << "; return ;;" << endl;
+		out << "\t-L|--list) compadd -- " << listing_names << "; return ;;" << endl;
+		out << "\t-f|--file) _files; return ;;" << endl;
+		out << "\tesac" << endl;
+		out << "\t[[ $PREFIX == -* ]] && return 1" << endl;
+		out << "\tlocal -a candidates" << endl;
+		out << "\tcandidates=(${(f)\"$(" << program << " --complete \"$PREFIX\" --scheme \"$scheme\" 2>/dev/null)\"})" << endl;
+		out << "\tcompadd -S '' -Q -- $candidates" << endl;
+		out << "}" << endl;
+		out << "compdef _gpcrn gpcrn" << endl;
+	}
+	return out.str();
+}
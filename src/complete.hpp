@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <set>
+#include <vector>
+#include <utility>
+using namespace std;
+
+//! A sorted array of keys answering prefix queries with a single lower_bound.
+class prefix_index
+{
+public:
+	//! Adds a key; call build() once all keys are added.
+	void add(const string& key);
+
+	//! Sorts and deduplicates the keys.
+	void build();
+
+	//! Returns the keys starting with prefix, compared case-insensitively, in sorted order.
+	vector<string> complete(const string& prefix, size_t limit = SIZE_MAX) const;
+
+	size_t size() const { return keys.size(); }
+
+private:
+	vector<pair<string, string>> keys; // folded_key => key
+};
+
+//! Completes a partial query word: a target prefix, or a '<target>:' followed by a numbering prefix of the given scheme.
+vector<string> complete_query(const string& word, int scheme_id, size_t limit = SIZE_MAX);
+
+//! Generates a shell completion script for bash or zsh; returns an empty string for an unsupported shell.
+string completion_script(const string& shell, const string& program, const set<string>& listings);
@@ -0,0 +1,487 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#ifdef GPCRN_ZLIB
+#include <zlib.h>
+#endif
+#ifdef GPCRN_ZSTD
+#include <zstd.h>
+#endif
+#include "compress.hpp"
+#include "ring.hpp"
+using namespace std;
+
+static const size_t block_size = 1 << 18;
+
+enum class format
+{
+	plain,
+	gzip,
+	zstd,
+};
+
+static const char* name_of(format f)
+{
+	return f == format::gzip ? "gzip" : "zstd";
+}
+
+// one direction of one compression format, turning chunks of input into output; throws runtime_error on corrupt data
+class codec
+{
+public:
+	virtual ~codec() = default;
+
+	// the last call has finish set, after all of the input
+	virtual void process(const char* data, size_t size, string& out, bool finish) = 0;
+};
+
+#ifdef GPCRN_ZLIB
+
+class gzip_decoder : public codec
+{
+public:
+	gzip_decoder()
+	{
+		// 15 + 32 accepts both gzip and zlib headers
+		if (inflateInit2(&z, 15 + 32) != Z_OK)
+			throw runtime_error("cannot initialize zlib");
+	}
+
+	~gzip_decoder() override
+	{
+		inflateEnd(&z);
+	}
+
+	void process(const char* data, size_t size, string& out, bool finish) override
+	{
+		char buffer[1 << 16];
+		z.next_in = (Bytef*)data;
+		z.avail_in = (uInt)size;
+		do
+		{
+			z.next_out = (Bytef*)buffer;
+			z.avail_out = sizeof(buffer);
+			int r = inflate(&z, Z_NO_FLUSH);
+			out.append(buffer, sizeof(buffer) - z.avail_out);
+
+			// concatenated members, as written by parallel compressors, follow one another
+			if (r == Z_STREAM_END)
+			{
+				inflateReset(&z);
+				ended = true;
+			}
+			else if (r == Z_OK)
+				ended = false;
+			else if (r != Z_BUF_ERROR)
+				throw runtime_error("invalid gzip data");
+		} while (z.avail_in || !z.avail_out);
+
+		if (finish && !ended)
+			throw runtime_error("truncated gzip data");
+	}
+
+private:
+	z_stream z{};
+	bool ended = true;
+};
+
+class gzip_encoder : public codec
+{
+public:
+	gzip_encoder()
+	{
+		// 15 + 16 writes a gzip header rather than a zlib one
+		if (deflateInit2(&z, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+			throw runtime_error("cannot initialize zlib");
+	}
+
+	~gzip_encoder() override
+	{
+		deflateEnd(&z);
+	}
+
+	void process(const char* data, size_t size, string& out, bool finish) override
+	{
+		char buffer[1 << 16];
+		z.next_in = (Bytef*)data;
+		z.avail_in = (uInt)size;
+		for (;;)
+		{
+			z.next_out = (Bytef*)buffer;
+			z.avail_out = sizeof(buffer);
+			int r = deflate(&z, finish ? Z_FINISH : Z_NO_FLUSH);
+			if (r == Z_STREAM_ERROR)
+				throw runtime_error("gzip compression failed");
+			out.append(buffer, sizeof(buffer) - z.avail_out);
+			if (finish ? r == Z_STREAM_END : !z.avail_in && z.avail_out)
+				break;
+		}
+	}
+
+private:
+	z_stream z{};
+};
+
+#endif
+
+#ifdef GPCRN_ZSTD
+
+class zstd_decoder : public codec
+{
+public:
+	zstd_decoder() : stream(ZSTD_createDStream())
+	{
+		if (!stream)
+			throw runtime_error("cannot initialize zstd");
+	}
+
+	~zstd_decoder() override
+	{
+		ZSTD_freeDStream(stream);
+	}
+
+	void process(const char* data, size_t size, string& out, bool finish) override
+	{
+		char buffer[1 << 16];
+		ZSTD_inBuffer in{ data, size, 0 };
+		ZSTD_outBuffer o{ buffer, sizeof(buffer), 0 };
+		while (in.pos < in.size || o.pos == o.size)
+		{
+			o.pos = 0;
+			// concatenated frames are decoded one after another
+			auto r = ZSTD_decompressStream(stream, &o, &in);
+			if (ZSTD_isError(r))
+				throw runtime_error(string("invalid zstd data; ") + ZSTD_getErrorName(r));
+			out.append(buffer, o.pos);
+			ended = r == 0;
+		}
+
+		if (finish && !ended)
+			throw runtime_error("truncated zstd data");
+	}
+
+private:
+	ZSTD_DStream* stream;
+	bool ended = true;
+};
+
+class zstd_encoder : public codec
+{
+public:
+	zstd_encoder() : context(ZSTD_createCCtx())
+	{
+		if (!context)
+			throw runtime_error("cannot initialize zstd");
+	}
+
+	~zstd_encoder() override
+	{
+		ZSTD_freeCCtx(context);
+	}
+
+	void process(const char* data, size_t size, string& out, bool finish) override
+	{
+		char buffer[1 << 16];
+		ZSTD_inBuffer in{ data, size, 0 };
+		for (;;)
+		{
+			ZSTD_outBuffer o{ buffer, sizeof(buffer), 0 };
+			auto r = ZSTD_compressStream2(context, &o, &in, finish ? ZSTD_e_end : ZSTD_e_continue);
+			if (ZSTD_isError(r))
+				throw runtime_error(string("zstd compression failed; ") + ZSTD_getErrorName(r));
+			out.append(buffer, o.pos);
+			if (finish ? r == 0 : in.pos == in.size)
+				break;
+		}
+	}
+
+private:
+	ZSTD_CCtx* context;
+};
+
+#endif
+
+static unique_ptr<codec> make_codec(format f, bool decode, const path& file)
+{
+#ifdef GPCRN_ZLIB
+	if (f == format::gzip)
+		return decode ? unique_ptr<codec>(make_unique<gzip_decoder>()) : make_unique<gzip_encoder>();
+#endif
+#ifdef GPCRN_ZSTD
+	if (f == format::zstd)
+		return decode ? unique_ptr<codec>(make_unique<zstd_decoder>()) : make_unique<zstd_encoder>();
+#endif
+	throw runtime_error("cannot " + string(decode ? "read" : "write") + " '" + file.string() + "'; gpcrn was built without " + name_of(f) + " support");
+}
+
+// A file buffer whose first bytes can be looked at without consuming them, as pipes cannot seek back to them,
+// and whose read errors are thrown as runtime_error naming the file.
+class peek_filebuf : public filebuf
+{
+public:
+	explicit peek_filebuf(const path& file) : file(file)
+	{
+	}
+
+	// up to n bytes, fewer if the file is shorter or the first read of a pipe returns fewer
+	string peek(size_t n)
+	{
+		if (traits_type::eq_int_type(sgetc(), traits_type::eof()))
+			return string();
+		return string(gptr(), min<size_t>(n, egptr() - gptr()));
+	}
+
+protected:
+	int_type underflow() override
+	{
+		try
+		{
+			return filebuf::underflow();
+		}
+		catch (exception&)
+		{
+			throw runtime_error("cannot read '" + file.string() + "'; " + strerror(errno));
+		}
+	}
+
+private:
+	path file;
+};
+
+// Decompressed blocks come from a thread reading and decoding the file ahead of the consumer.
+class decompress_buffer : public streambuf
+{
+public:
+	decompress_buffer(const path& file, unique_ptr<peek_filebuf>&& in, unique_ptr<codec>&& decoder) : file(file), in(move(in)), decoder(move(decoder))
+	{
+		worker = thread([this] { decompress(); });
+	}
+
+	~decompress_buffer() override
+	{
+		stop = true;
+		blocks.abandon();
+		worker.join();
+	}
+
+protected:
+	int_type underflow() override
+	{
+		while (gptr() == egptr())
+		{
+			if (blocks.try_pop(current))
+			{
+				setg(current.data(), current.data(), current.data() + current.size());
+				continue;
+			}
+			if (blocks.drained())
+			{
+				// the worker sets the error before it closes the ring
+				if (error.size())
+					throw runtime_error("cannot read '" + file.string() + "'; " + error);
+				return traits_type::eof();
+			}
+			blocks.wait_readable();
+		}
+		return traits_type::to_int_type(*gptr());
+	}
+
+private:
+	void decompress()
+	{
+		try
+		{
+			vector<char> chunk(block_size);
+			string block;
+			for (bool finish = false; !finish && !stop;)
+			{
+				auto n = in->sgetn(chunk.data(), chunk.size());
+				finish = n < (streamsize)chunk.size();
+				decoder->process(chunk.data(), (size_t)n, block, finish);
+				if ((block.size() >= block_size || finish) && block.size() && !push(block))
+					break;
+			}
+		}
+		catch (exception& ex)
+		{
+			error = ex.what();
+		}
+		blocks.close();
+	}
+
+	bool push(string& block)
+	{
+		while (!blocks.try_push(block))
+		{
+			if (stop)
+				return false;
+			blocks.wait_writable();
+		}
+		block.clear();
+		return true;
+	}
+
+	path file;
+	unique_ptr<peek_filebuf> in;
+	unique_ptr<codec> decoder;
+	spsc_ring<string> blocks{ 16 };
+	string current, error;
+	atomic<bool> stop{ false };
+	thread worker;
+};
+
+// Filled blocks go to a thread compressing and writing them behind the producer.
+class compress_buffer : public compressed_output
+{
+public:
+	compress_buffer(const path& file, ofstream&& out, unique_ptr<codec>&& encoder) : file(file), out(move(out)), encoder(move(encoder))
+	{
+		current.resize(block_size);
+		setp(current.data(), current.data() + current.size());
+		worker = thread([this] { compress(); });
+	}
+
+	~compress_buffer() override
+	{
+		if (!closed && !close())
+			cerr << "ERROR: cannot write '" << file.string() << "'; " << error << endl;
+	}
+
+	bool close() override
+	{
+		if (!closed)
+		{
+			hand_off();
+			blocks.close();
+			worker.join();
+			closed = true;
+		}
+		return error.empty();
+	}
+
+protected:
+	int_type overflow(int_type c) override
+	{
+		hand_off();
+		if (!traits_type::eq_int_type(c, traits_type::eof()))
+		{
+			*pptr() = traits_type::to_char_type(c);
+			pbump(1);
+		}
+		return traits_type::not_eof(c);
+	}
+
+	// the compressor keeps its state across blocks, so a flush only hands the pending bytes on
+	int sync() override
+	{
+		hand_off();
+		return 0;
+	}
+
+private:
+	void hand_off()
+	{
+		if (pptr() == pbase())
+			return;
+		current.resize(pptr() - pbase());
+		while (!blocks.try_push(current))
+			blocks.wait_writable();
+		current.resize(block_size);
+		setp(current.data(), current.data() + current.size());
+	}
+
+	void compress()
+	{
+		string block, compressed;
+		for (;;)
+		{
+			bool finish = false;
+			if (!blocks.try_pop(block))
+			{
+				if (!blocks.drained())
+				{
+					blocks.wait_readable();
+					continue;
+				}
+				block.clear();
+				finish = true;
+			}
+
+			// after an error the blocks are still taken so that the producer never waits forever
+			if (error.empty())
+			{
+				try
+				{
+					compressed.clear();
+					encoder->process(block.data(), block.size(), compressed, finish);
+					if (!out.write(compressed.data(), compressed.size()) || (finish && !out.flush()))
+						throw runtime_error("write error");
+				}
+				catch (exception& ex)
+				{
+					error = ex.what();
+				}
+			}
+			if (finish)
+				break;
+		}
+	}
+
+	path file;
+	ofstream out;
+	unique_ptr<codec> encoder;
+	spsc_ring<string> blocks{ 16 };
+	string current, error;
+	thread worker;
+	bool closed = false;
+};
+
+// an input stream owning its buffer
+class owning_istream : public istream
+{
+public:
+	explicit owning_istream(unique_ptr<streambuf>&& buffer) : istream(buffer.get()), buffer(std::move(buffer))
+	{
+	}
+
+private:
+	unique_ptr<streambuf> buffer;
+};
+
+unique_ptr<istream> open_input(const path& file)
+{
+	auto in = make_unique<peek_filebuf>(file);
+	if (!in->open(file, ios::in | ios::binary))
+		throw runtime_error("cannot open '" + file.string() + "'");
+
+	auto magic = in->peek(4);
+	magic.resize(4);
+	auto f = magic[0] == '\x1f' && magic[1] == '\x8b' ? format::gzip
+		: magic == "\x28\xb5\x2f\xfd" ? format::zstd
+		: format::plain;
+	if (f == format::plain)
+		return make_unique<owning_istream>(move(in));
+
+	auto decoder = make_codec(f, true, file);
+	return make_unique<owning_istream>(make_unique<decompress_buffer>(file, move(in), move(decoder)));
+}
+
+unique_ptr<compressed_output> open_compressed_output(const path& file)
+{
+	auto ext = file.extension().string();
+	transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+	auto f = ext == ".gz" ? format::gzip : ext == ".zst" ? format::zstd : format::plain;
+	if (f == format::plain)
+		return nullptr;
+
+	auto encoder = make_codec(f, false, file);
+	ofstream out(file, ios::binary);
+	if (!out)
+		throw runtime_error("cannot write '" + file.string() + "'");
+	return make_unique<compress_buffer>(file, move(out), move(encoder));
+}
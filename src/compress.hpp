@@ -0,0 +1,25 @@
+#pragma once
+#include <filesystem>
+#include <istream>
+#include <memory>
+#include <streambuf>
+using namespace std;
+using namespace std::filesystem;
+
+//! Opens a query file, decompressing gzip and zstd files, which are told apart by their first bytes, on a thread of their own.
+//! The first bytes are looked at without seeking, so pipes such as /dev/stdin or <(...) work as well.
+//! Throws runtime_error if the file cannot be opened or read, or gpcrn was built without the library its format needs;
+//! reading corrupt or truncated data, or failing to read, throws runtime_error as well.
+unique_ptr<istream> open_input(const path& file);
+
+//! A stream buffer compressing into a file on a thread of its own, whose write errors surface only when it is closed.
+class compressed_output : public streambuf
+{
+public:
+	//! Writes out everything buffered and waits for the thread; returns false if anything could not be written.
+	virtual bool close() = 0;
+};
+
+//! Returns a stream buffer writing into a file and compressing it on a thread of its own if the file name ends in .gz or .zst,
+//! or nullptr for any other file name. Throws runtime_error under the same conditions as open_input().
+unique_ptr<compressed_output> open_compressed_output(const path& file);
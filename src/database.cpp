@@ -0,0 +1,413 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include "assets.hpp"
+#include "database.hpp"
+using namespace std;
+
+static const char magic[8] = { 'G', 'P', 'C', 'R', 'N', 'D', 'B', '\0' };
+static const uint32_t format_version = 1;
+
+// strings longer than this are taken for corruption rather than allocated
+static const uint32_t max_string = 1 << 20;
+
+class database_writer
+{
+public:
+	database_writer(const path& file) : file(file), out(file, ios::binary)
+	{
+		if (!out)
+			throw runtime_error("cannot write database '" + file.string() + "'");
+	}
+
+	void u32(uint32_t value)
+	{
+		char bytes[4] = { (char)value, (char)(value >> 8), (char)(value >> 16), (char)(value >> 24) };
+		out.write(bytes, sizeof(bytes));
+	}
+
+	void i16(int16_t value)
+	{
+		char bytes[2] = { (char)value, (char)((uint16_t)value >> 8) };
+		out.write(bytes, sizeof(bytes));
+	}
+
+	void str(const string& s)
+	{
+		u32((uint32_t)s.size());
+		out.write(s.data(), s.size());
+	}
+
+	template<class Map>
+	void dict(const Map& m)
+	{
+		u32((uint32_t)m.size());
+		for (auto& [key, value] : m)
+		{
+			str(key);
+			str(value);
+		}
+	}
+
+	void write(const char* data, size_t size)
+	{
+		out.write(data, size);
+	}
+
+	void close()
+	{
+		out.close();
+		if (!out)
+			throw runtime_error("cannot write database '" + file.string() + "'");
+	}
+
+private:
+	path file;
+	ofstream out;
+};
+
+class database_reader
+{
+public:
+	database_reader(const path& file) : file(file), in(file, ios::binary)
+	{
+		if (!in)
+			throw runtime_error("cannot open database '" + file.string() + "'");
+	}
+
+	[[noreturn]] void fail(const string& message) const
+	{
+		throw runtime_error("invalid database '" + file.string() + "'; " + message);
+	}
+
+	void read(char* data, size_t size)
+	{
+		if (!in.read(data, size))
+			fail("unexpected end of file");
+	}
+
+	uint32_t u32()
+	{
+		unsigned char b[4];
+		read((char*)b, sizeof(b));
+		return b[0] | b[1] << 8 | b[2] << 16 | (uint32_t)b[3] << 24;
+	}
+
+	int16_t i16()
+	{
+		unsigned char b[2];
+		read((char*)b, sizeof(b));
+		return (int16_t)(b[0] | b[1] << 8);
+	}
+
+	// a count of elements that are allocated up front, which must not exceed a sane limit
+	uint32_t count(size_t limit)
+	{
+		auto n = u32();
+		if (n > limit)
+			fail("count " + to_string(n) + " exceeds " + to_string(limit));
+		return n;
+	}
+
+	string str()
+	{
+		auto size = u32();
+		if (size > max_string)
+			fail("string of " + to_string(size) + " bytes");
+		string s(size, '\0');
+		read(s.data(), size);
+		return s;
+	}
+
+	template<class Map>
+	void dict(Map& m)
+	{
+		for (auto n = u32(); n; n--)
+		{
+			auto key = str();
+			m.emplace(key, str());
+		}
+	}
+
+	bool at_end()
+	{
+		return in.peek() == char_traits<char>::eof();
+	}
+
+private:
+	path file;
+	ifstream in;
+};
+
+void write_database(const path& file)
+{
+	auto& t = tables();
+	database_writer w(file);
+	w.write(magic, sizeof(magic));
+	w.u32(format_version);
+	w.str(t.version);
+
+	w.u32((uint32_t)t.schemes.size());
+	for (auto& [offset, width, names] : t.schemes)
+	{
+		w.u32((uint32_t)offset);
+		w.u32((uint32_t)width);
+		w.u32((uint32_t)names.size());
+		for (auto& name : names)
+			w.str(name);
+	}
+
+	w.u32((uint32_t)t.string_table.size());
+	for (auto& row : t.string_table)
+		w.str(row);
+
+	w.u32((uint32_t)t.uniprot_dict.size());
+	for (auto& [uid, entry] : t.uniprot_dict)
+	{
+		auto& [symbol, species, gene_name, long_species] = entry;
+		w.str(uid);
+		w.str(symbol);
+		w.str(species);
+		w.str(gene_name);
+		w.str(long_species);
+	}
+
+	w.dict(t.class_dict);
+	w.dict(t.symbol_dict);
+	w.dict(t.symbol_species_dict);
+	w.dict(t.gene_name_dict);
+	w.dict(t.pdb_id_dict);
+
+	w.u32((uint32_t)t.numbering_data.size());
+	for (auto& [uid, numbering] : t.numbering_data)
+	{
+		auto& [low, length, residues, runs] = numbering;
+		w.str(uid);
+		w.u32((uint32_t)low);
+		w.u32((uint32_t)length);
+		w.str(residues);
+		w.u32((uint32_t)runs.size());
+		for (auto& [offset, count, first] : runs)
+		{
+			w.i16(offset);
+			w.i16(count);
+			w.i16(first);
+		}
+	}
+	w.close();
+}
+
+database_tables load_database(const path& file)
+{
+	database_reader r(file);
+	database_tables t;
+
+	char m[sizeof(magic)];
+	r.read(m, sizeof(m));
+	if (!equal(begin(m), end(m), begin(magic)))
+		r.fail("not a gpcrn database");
+	if (auto version = r.u32(); version != format_version)
+		r.fail("unsupported format version " + to_string(version));
+
+	t.version = r.str();
+
+	auto& new_schemes = t.schemes;
+	if (r.u32() != scheme_count)
+		r.fail("expected " + to_string(scheme_count) + " schemes");
+	size_t row_width = 0;
+	for (auto& [offset, width, names] : new_schemes)
+	{
+		offset = r.u32();
+		width = r.u32();
+		names.resize(r.count(16));
+		for (auto& name : names)
+			name = r.str();
+		if (names.size() < 2)
+			r.fail("a scheme needs a name and an abbreviation");
+		row_width = max(row_width, offset + width);
+	}
+
+	// string indices are stored as shorts
+	auto& new_table = t.string_table;
+	new_table.resize(r.count(32767));
+	for (auto& row : new_table)
+	{
+		row = r.str();
+		if (row.size() < row_width)
+			r.fail("string table row '" + row + "' is narrower than the schemes");
+	}
+
+	auto& new_uniprot = t.uniprot_dict;
+	for (auto n = r.u32(); n; n--)
+	{
+		auto uid = r.str();
+		auto& [symbol, species, gene_name, long_species] = new_uniprot[uid];
+		symbol = r.str();
+		species = r.str();
+		gene_name = r.str();
+		long_species = r.str();
+	}
+
+	r.dict(t.class_dict);
+	r.dict(t.symbol_dict);
+	r.dict(t.symbol_species_dict);
+	r.dict(t.gene_name_dict);
+	r.dict(t.pdb_id_dict);
+
+	auto& new_numbering = t.numbering_data;
+	for (auto n = r.u32(); n; n--)
+	{
+		auto uid = r.str();
+		auto& [low, length, residues, runs] = new_numbering[uid];
+		low = (int)r.u32();
+		length = (int)r.u32();
+		residues = r.str();
+		runs.resize(r.count(residues.size()));
+
+		// runs must be ordered and disjoint for the binary search in find_residue()
+		int covered = 0;
+		for (auto& [offset, count, first] : runs)
+		{
+			offset = r.i16();
+			count = r.i16();
+			first = r.i16();
+			if (offset < covered || count < 0 || offset + count > length || first < 0 || first + count > (int)new_table.size())
+				r.fail("numbering of '" + uid + "' is out of range");
+			covered = offset + count;
+		}
+		if ((int)residues.size() != length)
+			r.fail("numbering of '" + uid + "' has " + to_string(residues.size()) + " residues instead of " + to_string(length));
+		if (!new_uniprot.count(uid))
+			r.fail("numbering of unknown receptor '" + uid + "'");
+	}
+
+	if (!r.at_end())
+		r.fail("trailing data");
+
+	return t;
+}
+
+static atomic<unsigned long> identities{ 0 };
+static atomic<size_t> slots{ 0 };
+
+derived_values::derived_values() : id(++identities), entries(make_unique<array<entry, capacity>>())
+{
+}
+
+derived_values& derived_values::operator=(const derived_values&)
+{
+	id = ++identities;
+	entries = make_unique<array<entry, capacity>>();
+	return *this;
+}
+
+size_t derived_values::reserve()
+{
+	auto slot = slots++;
+	if (slot >= capacity)
+		throw logic_error("more than " + to_string(capacity) + " values derived from the tables");
+	return slot;
+}
+
+// the latest set, always accessed through atomic_load() and atomic_store(), and a plain pointer to it for the threads
+// reading it without a pin
+static shared_ptr<const database_tables> latest;
+static atomic<const database_tables*> latest_pointer{ nullptr };
+static once_flag builtin_loaded;
+static thread_local const database_tables* pinned_tables = nullptr;
+static atomic<bool> reloads_allowed{ false };
+
+// the compiled-in tables are moved into the first set, which is cheap and leaves them empty
+static void load_builtin()
+{
+	call_once(builtin_loaded, []
+	{
+		static_assert(schemes.size() == scheme_count, "the assets have another number of schemes");
+		auto t = make_shared<database_tables>();
+		t->version = move(gpcrdb_version);
+		t->schemes = move(schemes);
+		t->string_table = move(string_table);
+		t->uniprot_dict = move(uniprot_dict);
+		t->class_dict = move(class_dict);
+		t->symbol_dict = move(symbol_dict);
+		t->symbol_species_dict = move(symbol_species_dict);
+		t->gene_name_dict = move(gene_name_dict);
+		t->pdb_id_dict = move(pdb_id_dict);
+		t->numbering_data = move(numbering_data);
+		latest_pointer.store(t.get(), memory_order_release);
+		atomic_store(&latest, shared_ptr<const database_tables>(move(t)));
+	});
+}
+
+const database_tables& tables()
+{
+	if (pinned_tables)
+		return *pinned_tables;
+	if (reloads_allowed.load(memory_order_relaxed))
+		throw logic_error("the tables are read without a pin while they may be reloaded");
+	auto t = latest_pointer.load(memory_order_acquire);
+	if (!t)
+	{
+		load_builtin();
+		t = latest_pointer.load(memory_order_acquire);
+	}
+	return *t;
+}
+
+shared_ptr<const database_tables> latest_tables()
+{
+	load_builtin();
+	return atomic_load(&latest);
+}
+
+database_tables loaded_tables()
+{
+	return tables();
+}
+
+void publish_tables(shared_ptr<const database_tables> t)
+{
+	load_builtin();
+	latest_pointer.store(t.get(), memory_order_release);
+	atomic_store(&latest, move(t));
+}
+
+void use_tables(database_tables&& t)
+{
+	publish_tables(make_shared<const database_tables>(move(t)));
+}
+
+void allow_reloads()
+{
+	reloads_allowed.store(true, memory_order_relaxed);
+}
+
+tables_pin::tables_pin(shared_ptr<const database_tables> t) : pinned(move(t)), outer(pinned_tables)
+{
+	pinned_tables = pinned.get();
+}
+
+tables_pin::~tables_pin()
+{
+	pinned_tables = outer;
+}
+
+void read_database(const path& file)
+{
+	// everything is read aside and swapped in only once it is known to be consistent
+	use_tables(load_database(file));
+}
+
+string read_database_version(const path& file)
+{
+	database_reader r(file);
+	char m[sizeof(magic)];
+	r.read(m, sizeof(m));
+	if (!equal(begin(m), end(m), begin(magic)))
+		r.fail("not a gpcrn database");
+	if (auto version = r.u32(); version != format_version)
+		r.fail("unsupported format version " + to_string(version));
+	return r.str();
+}
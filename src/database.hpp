@@ -0,0 +1,155 @@
+#pragma once
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <filesystem>
+using namespace std;
+using namespace std::filesystem;
+
+// A binary database holds the same tables as the compiled-in assets so that a new GPCRdb snapshot can be used without
+// recompiling gpcrn. All integers are little-endian and every string is prefixed with its 32-bit length:
+//
+//   "GPCRNDB" '\0' <format_version:u32> <gpcrdb_version>
+//   <schemes:u32>  { <offset:u32> <width:u32> <names:u32> <name>... }...
+//   <rows:u32>     { <row> }...
+//   <receptors:u32> { <uniprot_id> <symbol> <species> <gene_name> <long_species> }...
+//   class_dict, symbol_dict, symbol_species_dict, gene_name_dict and pdb_id_dict, each as <pairs:u32> { <key> <value> }...
+//   <numberings:u32> { <uniprot_id> <low:i32> <length:i32> <residues> <runs:u32> { <offset:i16> <count:i16> <first_index:i16> }... }...
+
+//! The values that table_cache derives from a set of tables, each built once by the first thread to need it and freed
+//! with the set. A copy of a set starts without any, under an identity of its own.
+class derived_values
+{
+public:
+	derived_values();
+	derived_values(const derived_values&) : derived_values() {}
+	derived_values& operator=(const derived_values&);
+
+	//! Distinguishes the set from every other one made in this process, for keys derived from it such as cached answers.
+	unsigned long identity() const { return id; }
+
+	//! Takes a slot for a value derived from every set; throws logic_error once all are taken.
+	static size_t reserve();
+
+	//! Returns the value in a slot, built by build() first if it is not yet.
+	template<class T, class F>
+	const T& get(size_t slot, F build) const
+	{
+		auto& e = (*entries)[slot];
+		call_once(e.once, [&] { e.value = make_shared<const T>(build()); });
+		return *static_cast<const T*>(e.value.get());
+	}
+
+private:
+	struct entry
+	{
+		once_flag once;
+		shared_ptr<const void> value;
+	};
+	static const size_t capacity = 128;
+
+	unsigned long id;
+	unique_ptr<array<entry, capacity>> entries;
+};
+
+//! A complete set of the tables. The loaded set is shared by the threads reading it and never changed in place: it is
+//! replaced by publishing a new one, and freed with its derived values when the last thread reading it lets go.
+struct database_tables
+{
+	// date of the GPCRdb snapshot
+	string version;
+	// scheme_index => scheme_numbering_offset, scheme_numbering_length, scheme_names
+	array<tuple<size_t, size_t, vector<string>>, 12> schemes;
+	// string_index => string
+	vector<string> string_table;
+	// uniprot_id => [symbol, species, gene_name, long_species]
+	map<string, tuple<string, string, string, string>> uniprot_dict;
+	// uniprot_id => class
+	map<string, string> class_dict;
+	// symbol => uniprot_id
+	multimap<string, string> symbol_dict;
+	// symbol_species => uniprot_id
+	map<string, string> symbol_species_dict;
+	// gene_name => uniprot_id
+	multimap<string, string> gene_name_dict;
+	// pdb_id => uniprot_id
+	map<string, string> pdb_id_dict;
+	// uniprot_id => [low, length, residues, runs of [offset, count, first_string_table_index]...]
+	map<string, tuple<int, int, string, vector<array<short, 3>>>> numbering_data;
+	// the values of table_cache built from this set
+	mutable derived_values derived;
+};
+
+//! The number of schemes, for arrays with a value per scheme.
+constexpr size_t scheme_count = tuple_size<decltype(database_tables::schemes)>::value;
+
+//! Writes the loaded tables into a binary database file; throws runtime_error if the file cannot be written.
+void write_database(const path& file);
+
+//! Replaces the loaded tables with those of a binary database file; throws runtime_error on unreadable or inconsistent input,
+//! in which case the loaded tables are left untouched.
+void read_database(const path& file);
+
+//! Reads the tables of a binary database file without loading them; throws runtime_error on unreadable or inconsistent input.
+database_tables load_database(const path& file);
+
+//! The tables read by this thread: the set pinned by its innermost tables_pin, or else the latest loaded one, which
+//! stays valid only as long as no other thread replaces it. The built-in tables are loaded on the first call. Throws
+//! logic_error when no set is pinned once reloads are allowed.
+const database_tables& tables();
+
+//! Lets other threads replace the tables from now on, so that every thread reading them must pin a set first.
+void allow_reloads();
+
+//! The latest loaded set of tables, which lives on as long as the pointer does.
+shared_ptr<const database_tables> latest_tables();
+
+//! Returns a copy of the tables read by this thread.
+database_tables loaded_tables();
+
+//! Loads a set of tables in place of the latest one, which is freed once no thread reads it any more. Threads that
+//! pinned a set keep reading it, the others read the new one from their next call to tables() on.
+void publish_tables(shared_ptr<const database_tables> t);
+
+//! Loads a set of tables as publish_tables() does.
+void use_tables(database_tables&& t);
+
+//! Makes this thread read one set of tables for as long as it lives: the latest one, or a given one not loaded yet.
+class tables_pin
+{
+public:
+	tables_pin() : tables_pin(latest_tables()) {}
+	explicit tables_pin(shared_ptr<const database_tables> t);
+	~tables_pin();
+	tables_pin(const tables_pin&) = delete;
+	tables_pin& operator=(const tables_pin&) = delete;
+
+private:
+	shared_ptr<const database_tables> pinned;
+	const database_tables* outer;
+};
+
+//! A value derived from the tables, built by the first thread to need it from the set it reads and kept with that set.
+//! A reference to the value is valid for as long as the set is read.
+template<class T>
+class table_cache
+{
+public:
+	table_cache() : slot(derived_values::reserve()) {}
+
+	template<class F>
+	const T& get(F build) const
+	{
+		return tables().derived.get<T>(slot, build);
+	}
+
+private:
+	size_t slot;
+};
+
+//! Reads only the GPCRdb version of a binary database file; throws runtime_error if it is not one.
+string read_database_version(const path& file);
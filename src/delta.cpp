@@ -0,0 +1,321 @@
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include "database.hpp"
+#include "delta.hpp"
+#include "numbering.hpp"
+#include "string.hpp"
+using namespace std;
+
+static string to_upper(string s)
+{
+	transform(s.begin(), s.end(), s.begin(), ::toupper);
+	return s;
+}
+
+template<class Map>
+static void erase_values(Map& dict, const string& value)
+{
+	for (auto it = dict.begin(); it != dict.end();)
+		it = it->second == value ? dict.erase(it) : next(it);
+}
+
+// drop the symbol, symbol_species and gene name entries leading to a receptor
+static void unlink_receptor(database_tables& t, const string& uid)
+{
+	erase_values(t.symbol_dict, uid);
+	erase_values(t.symbol_species_dict, uid);
+	erase_values(t.gene_name_dict, uid);
+}
+
+static size_t row_width(const database_tables& t)
+{
+	auto& [offset, width, names] = t.schemes.back();
+	return offset + width;
+}
+
+void apply_delta(istream& in, const string& name)
+{
+	// the loaded tables are patched in a copy, which a malformed delta leaves unloaded
+	auto t = loaded_tables();
+	apply_delta(t, in, name);
+	use_tables(move(t));
+}
+
+void apply_delta(database_tables& t, istream& in, const string& name)
+{
+	auto& [gpcrdb_version, schemes, string_table, uniprot_dict, class_dict, symbol_dict, symbol_species_dict, gene_name_dict, pdb_id_dict, numbering_data, ignore] = t;
+	int line_no = 0;
+	for (string line; safe_getline(in, line);)
+	{
+		++line_no;
+		if (trim(string(line)).empty() || line[0] == '#')
+			continue;
+
+		auto fields = split(line, '\t', false);
+		auto& op = fields[0];
+
+		auto fail = [&](const string& message)
+		{
+			throw runtime_error(name + ":" + to_string(line_no) + ": " + message);
+		};
+
+		auto expect = [&](size_t count)
+		{
+			if (fields.size() != count + 1)
+				fail("'" + op + "' takes " + to_string(count) + " tab-separated fields");
+		};
+
+		auto to_int = [&](const string& s)
+		{
+			size_t n = 0;
+			int value = 0;
+			try
+			{
+				value = stoi(s, &n);
+			}
+			catch (exception&)
+			{
+			}
+			if (s.empty() || n != s.size())
+				fail("invalid number '" + s + "'");
+			return value;
+		};
+
+		// string indices are stored as shorts, with -1 for an unnumbered residue
+		auto to_index = [&](const string& s)
+		{
+			int value = to_int(s);
+			if (value < -1 || value > 32767)
+				fail("string index " + s + " is out of range");
+			return (short)value;
+		};
+
+		auto receptor = [&](const string& s)
+		{
+			auto uid = to_upper(s);
+			if (!uniprot_dict.count(uid))
+				fail("unknown receptor '" + s + "'");
+			return uid;
+		};
+
+		if (op == "version")
+		{
+			expect(1);
+			gpcrdb_version = fields[1];
+		}
+		else if (op == "string")
+		{
+			expect(2);
+			int index = to_int(fields[1]);
+			if (index < 0 || index > (int)string_table.size())
+				fail("string index " + fields[1] + " is neither an existing row nor the next one");
+			if (fields[2].size() > row_width(t))
+				fail("row is wider than the " + to_string(row_width(t)) + " columns of the string table");
+
+			auto row = pad_right(fields[2], row_width(t), ' ');
+			if (index == (int)string_table.size())
+				string_table.push_back(row);
+			else
+				string_table[index] = row;
+		}
+		else if (op == "receptor")
+		{
+			if (fields.size() != 7)
+				expect(5);
+			auto uid = to_upper(fields[1]), symbol = to_upper(fields[2]), species = to_upper(fields[3]), gene_name = to_upper(fields[4]);
+			unlink_receptor(t, uid);
+			uniprot_dict[uid] = { symbol, species, gene_name, fields[5] };
+			symbol_dict.emplace(symbol, uid);
+			symbol_species_dict[symbol + '_' + species] = uid;
+			gene_name_dict.emplace(gene_name, uid);
+			if (fields.size() == 7)
+				class_dict[uid] = to_upper(fields[6]);
+		}
+		else if (op == "-receptor")
+		{
+			expect(1);
+			auto uid = receptor(fields[1]);
+			unlink_receptor(t, uid);
+			erase_values(pdb_id_dict, uid);
+			uniprot_dict.erase(uid);
+			class_dict.erase(uid);
+			numbering_data.erase(uid);
+		}
+		else if (op == "pdb")
+		{
+			expect(2);
+			pdb_id_dict[to_upper(fields[1])] = receptor(fields[2]);
+		}
+		else if (op == "-pdb")
+		{
+			expect(1);
+			if (!pdb_id_dict.erase(to_upper(fields[1])))
+				fail("unknown pdb id '" + fields[1] + "'");
+		}
+		else if (op == "numbering")
+		{
+			expect(4);
+			auto uid = receptor(fields[1]);
+			int low = to_int(fields[2]);
+			auto& residues = fields[3];
+
+			vector<short> indices;
+			for (auto& s : split(fields[4], ','))
+				indices.push_back(to_index(trim(s)));
+			if (indices.size() != residues.size())
+				fail("expected " + to_string(residues.size()) + " string indices, one per residue, but got " + to_string(indices.size()));
+
+			numbering_data[uid] = { low, (int)residues.size(), residues, encode_runs(indices) };
+		}
+		else if (op == "residue")
+		{
+			expect(4);
+			auto uid = receptor(fields[1]);
+			int seq = to_int(fields[2]);
+			short index = to_index(fields[4]);
+			if (fields[3].size() != 1)
+				fail("residue must be a single letter code");
+
+			auto& numbering = numbering_data[uid];
+			auto& [low, length, residues, runs] = numbering;
+			auto indices = decode_runs(numbering);
+			if (length == 0)
+				low = seq;
+
+			// grow the sequence range with unnumbered gaps to cover seq
+			if (seq < low)
+			{
+				residues.insert(0, low - seq, '.');
+				indices.insert(indices.begin(), low - seq, -1);
+				length += low - seq;
+				low = seq;
+			}
+			if (seq >= low + length)
+			{
+				residues.append(seq - low - length + 1, '.');
+				indices.resize(seq - low + 1, -1);
+				length = seq - low + 1;
+			}
+
+			residues[seq - low] = (char)toupper(fields[3][0]);
+			indices[seq - low] = index;
+			runs = encode_runs(indices);
+		}
+		else
+		{
+			fail("unknown change '" + op + "'");
+		}
+	}
+
+	// rows may be appended after the numberings referring to them, so indices are checked once at the end
+	for (auto& [uid, numbering] : numbering_data)
+		for (auto& [offset, count, first] : get<3>(numbering))
+			if (first < 0 || first + count > (int)string_table.size())
+				throw runtime_error(name + ": numbering of '" + uid + "' refers to missing string index " + to_string(first < 0 ? first : first + count - 1));
+}
+
+template<class Dict, class Width>
+static size_t max_width(const Dict& dict, Width width)
+{
+	size_t w = 0;
+	for (auto& entry : dict)
+		w = max(w, width(entry));
+	return w;
+}
+
+static string padding(size_t width, size_t length)
+{
+	return string(width > length ? width - length : 0, ' ');
+}
+
+void write_assets(const path& dir)
+{
+	auto& t = tables();
+	ofstream hpp(dir / "assets.hpp", ios::binary), cpp(dir / "assets.cpp", ios::binary);
+	if (!hpp || !cpp)
+		throw runtime_error("cannot write assets into '" + dir.string() + "'");
+
+	hpp << "#include <map>\n#include <string>\n#include <vector>\n#include <array>\n#include <tuple>\nusing namespace std;\n\n";
+	cpp << "#include \"assets.hpp\"\n\n";
+
+	hpp << "// date of the GPCRdb snapshot\nextern string gpcrdb_version;\n\n";
+	cpp << "// date of the GPCRdb snapshot\nstring gpcrdb_version = \"" << t.version << "\";\n\n";
+
+	// string table
+	string top = "//   ", bottom = "//   ";
+	for (auto& [offset, width, names] : t.schemes)
+	{
+		top += pad_right(string("v"), width, ' ');
+		bottom += pad_right(string("^"), width, ' ');
+	}
+
+	hpp << "// string_index => string\nextern vector<string> string_table;\n\n";
+	cpp << "// string_index => string\nvector<string> string_table =\n{\n" << top << '\n';
+	for (auto& row : t.string_table)
+		cpp << "\t\"" << row << "\",\n";
+	cpp << bottom << "\n};\n\n";
+
+	// schemes
+	hpp << "// scheme_index => scheme_numbering_offset, scheme_numbering_length, scheme_names\n";
+	hpp << "extern array<tuple<size_t, size_t, vector<string>>, " << t.schemes.size() << "> schemes;\n\n";
+	cpp << "// scheme_index => scheme_numbering_offset, scheme_numbering_length, scheme_names\n";
+	cpp << "array<tuple<size_t, size_t, vector<string>>, " << t.schemes.size() << "> schemes =\n{{\n";
+	for (auto& [offset, width, names] : t.schemes)
+	{
+		cpp << "\t{" << offset << ", " << (offset < 10 ? " " : "") << width << ", {";
+		for (size_t i = 0; i < names.size(); i++)
+			cpp << (i ? ", " : "") << '"' << names[i] << '"';
+		cpp << "}},\n";
+	}
+	cpp << "}};\n\n";
+
+	// uniprot_id => [symbol, species, gene_name, long_species]
+	auto uid_w = max_width(t.uniprot_dict, [](auto& e) { return e.first.size(); });
+	auto symbol_w = max_width(t.uniprot_dict, [](auto& e) { return get<0>(e.second).size(); });
+	auto species_w = max_width(t.uniprot_dict, [](auto& e) { return get<1>(e.second).size(); });
+	auto gene_w = max_width(t.uniprot_dict, [](auto& e) { return get<2>(e.second).size(); });
+
+	hpp << "// uniprot_id => [symbol, species, gene_name, long_species]\nextern map<string, tuple<string, string, string, string>> uniprot_dict;\n\n";
+	cpp << "// uniprot_id => [symbol, species, gene_name, long_species]\nmap<string, tuple<string, string, string, string>> uniprot_dict =\n{\n";
+	for (auto& [uid, entry] : t.uniprot_dict)
+	{
+		auto& [symbol, species, gene_name, long_species] = entry;
+		cpp << "\t{\"" << uid << "\", " << padding(uid_w, uid.size())
+			<< "{\"" << symbol << "\", " << padding(symbol_w, symbol.size())
+			<< '"' << species << "\", " << padding(species_w, species.size())
+			<< '"' << gene_name << "\", " << padding(gene_w, gene_name.size())
+			<< '"' << long_species << "\"}},\n";
+	}
+	cpp << "};\n\n";
+
+	// the name dictionaries share one layout
+	auto write_dict = [&](const auto& dict, const string& comment, const string& type, const string& name, bool padded)
+	{
+		auto key_w = max_width(dict, [](auto& e) { return e.first.size(); });
+		hpp << "// " << comment << "\nextern " << type << ' ' << name << ";\n\n";
+		cpp << "// " << comment << '\n' << type << ' ' << name << " =\n{\n";
+		for (auto& [key, uid] : dict)
+			cpp << "\t{\"" << key << "\", " << (padded ? padding(key_w, key.size()) : "") << '"' << uid << "\"},\n";
+		cpp << "};\n\n";
+	};
+
+	write_dict(t.class_dict, "uniprot_id => class", "map<string, string>", "class_dict", true);
+	write_dict(t.symbol_dict, "symbol => uniprot_id", "multimap<string, string>", "symbol_dict", true);
+	write_dict(t.symbol_species_dict, "symbol_species => uniprot_id", "map<string, string>", "symbol_species_dict", true);
+	write_dict(t.gene_name_dict, "gene_name => uniprot_id", "multimap<string, string>", "gene_name_dict", true);
+	write_dict(t.pdb_id_dict, "pdb_id => uniprot_id", "map<string, string>", "pdb_id_dict", false);
+
+	// uniprot_id => [low, length, residues, runs of [offset, count, first_string_table_index]...]
+	hpp << "// uniprot_id => [low, length, residues, runs of [offset, count, first_string_table_index]...]\nextern map<string, tuple<int, int, string, vector<array<short, 3>>>> numbering_data;\n";
+	cpp << "// uniprot_id => [low, length, residues, runs of [offset, count, first_string_table_index]...]\nmap<string, tuple<int, int, string, vector<array<short, 3>>>> numbering_data =\n{\n";
+	for (auto& [uid, numbering] : t.numbering_data)
+	{
+		auto& [low, length, residues, runs] = numbering;
+		cpp << "\t{\n\t\t\"" << uid << "\",\n\t\t{\n\t\t\t" << low << ", " << length << ",\n\t\t\t\"" << residues << "\",\n\t\t\t{";
+		for (size_t i = 0; i < runs.size(); i++)
+			cpp << (i ? ", " : "") << '{' << runs[i][0] << ", " << runs[i][1] << ", " << runs[i][2] << '}';
+		cpp << "}\n\t\t}\n\t},\n";
+	}
+	cpp << "};\n";
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <string>
+#include <istream>
+#include <filesystem>
+#include "database.hpp"
+using namespace std;
+using namespace std::filesystem;
+
+// A delta file patches the compiled-in tables at load time. It is a tab-separated text file, one change per line,
+// applied in order; empty lines and lines starting with # are ignored.
+//
+//   version    <gpcrdb_version>                                               the GPCRdb version after this delta
+//   string     <string_index> <row>                                           replace a string_table row, or append at index == size
+//   receptor   <uniprot_id> <symbol> <species> <gene_name> <long_species> [<class>]
+//                                                                             add or change a receptor
+//   -receptor  <uniprot_id>                                                   remove a receptor with its numbering and pdb ids
+//   pdb        <pdb_id> <uniprot_id>                                          add or remap a pdb id
+//   -pdb       <pdb_id>                                                       remove a pdb id
+//   numbering  <uniprot_id> <low> <residues> <string_index,...>               replace the numbering of a receptor, -1 for unnumbered
+//   residue    <uniprot_id> <seq> <residue> <string_index>                    change the numbering of a single residue
+
+//! Applies a delta on top of the loaded tables; throws runtime_error naming the offending line on malformed input.
+void apply_delta(istream& in, const string& name);
+
+//! Applies a delta on top of a set of tables held aside from the loaded ones, in the same way.
+void apply_delta(database_tables& t, istream& in, const string& name);
+
+//! Writes the loaded tables as assets.hpp and assets.cpp into a directory, in the layout produced by GenerateAssets.
+void write_assets(const path& dir);
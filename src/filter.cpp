@@ -0,0 +1,292 @@
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include "database.hpp"
+#include "filter.hpp"
+#include "lookup.hpp"
+#include "numbering.hpp"
+#include "string.hpp"
+using namespace std;
+
+bitmap::bitmap(size_t size, bool value) : bits(size), words((size + 63) / 64, value ? ~0ull : 0)
+{
+	// keep the bits past the end clear so count() and operator~ stay exact
+	if (value && (size & 63))
+		words.back() = (1ull << (size & 63)) - 1;
+}
+
+size_t bitmap::ctz(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctzll(word);
+#else
+	size_t n = 0;
+	for (; !(word & 1); word >>= 1)
+		++n;
+	return n;
+#endif
+}
+
+size_t bitmap::count() const
+{
+	size_t n = 0;
+	for (auto word : words)
+		for (; word; word &= word - 1)
+			++n;
+	return n;
+}
+
+bitmap& bitmap::operator&=(const bitmap& other)
+{
+	for (size_t i = 0; i < words.size(); i++)
+		words[i] &= other.words[i];
+	return *this;
+}
+
+bitmap& bitmap::operator|=(const bitmap& other)
+{
+	for (size_t i = 0; i < words.size(); i++)
+		words[i] |= other.words[i];
+	return *this;
+}
+
+bitmap bitmap::operator~() const
+{
+	bitmap r(bits, true);
+	for (size_t i = 0; i < words.size(); i++)
+		r.words[i] &= ~words[i];
+	return r;
+}
+
+const vector<string>& receptor_ids()
+{
+	static table_cache<vector<string>> ids;
+	return ids.get([]
+	{
+		auto& t = tables();
+		vector<string> r;
+		for (auto& [uid, ignore] : t.uniprot_dict)
+			r.push_back(uid);
+		return r;
+	});
+}
+
+int receptor_ordinal(const string& uid)
+{
+	auto& ids = receptor_ids();
+	auto it = lower_bound(ids.begin(), ids.end(), uid);
+	return it != ids.end() && *it == uid ? (int)(it - ids.begin()) : -1;
+}
+
+struct filter_index
+{
+	map<string, bitmap> species;
+	map<string, bitmap> classes;
+	array<bitmap, scheme_count> coverage;
+};
+
+static const filter_index& get_filter_index()
+{
+	static table_cache<filter_index> index;
+	return index.get([]
+	{
+		auto& t = tables();
+		filter_index idx;
+		auto& ids = receptor_ids();
+
+		// schemes with a label in each string table row
+		vector<unsigned> row_schemes(t.string_table.size());
+		for (size_t r = 0; r < t.string_table.size(); r++)
+			for (size_t s = 0; s < t.schemes.size(); s++)
+				if (!trim(t.string_table[r].substr(get<0>(t.schemes[s]), get<1>(t.schemes[s]))).empty())
+					row_schemes[r] |= 1u << s;
+
+		for (auto& c : idx.coverage)
+			c = bitmap(ids.size());
+
+		for (size_t i = 0; i < ids.size(); i++)
+		{
+			auto& [symbol, species, gene_name, long_species] = t.uniprot_dict.at(ids[i]);
+			idx.species.try_emplace(species, ids.size()).first->second.set(i);
+
+			auto cls = t.class_dict.find(ids[i]);
+			if (cls != t.class_dict.end())
+				idx.classes.try_emplace(cls->second, ids.size()).first->second.set(i);
+
+			unsigned covered = 0;
+			auto numbering = t.numbering_data.find(ids[i]);
+			if (numbering != t.numbering_data.end())
+				for (auto& [offset, count, first] : get<3>(numbering->second))
+					for (int r = first; r < first + count; r++)
+						covered |= row_schemes[r];
+			for (size_t s = 0; s < t.schemes.size(); s++)
+				if (covered & (1u << s))
+					idx.coverage[s].set(i);
+		}
+		return idx;
+	});
+}
+
+// A recursive descent parser evaluating while it parses; each rule returns the bitmap of its subexpression.
+class filter_parser
+{
+public:
+	filter_parser(const string& expr) : expr(expr), index(get_filter_index())
+	{
+		tokenize();
+	}
+
+	bitmap parse()
+	{
+		auto r = parse_expr();
+		if (pos != tokens.size())
+			fail("unexpected '" + tokens[pos] + "'");
+		return r;
+	}
+
+private:
+	const string& expr;
+	const filter_index& index;
+	vector<string> tokens;
+	size_t pos = 0;
+
+	[[noreturn]] void fail(const string& message) const
+	{
+		throw runtime_error("invalid filter '" + expr + "'; " + message);
+	}
+
+	void tokenize()
+	{
+		for (size_t i = 0; i < expr.size();)
+		{
+			if (isspace(expr[i]))
+			{
+				++i;
+			}
+			else if (expr.compare(i, 2, "!=") == 0 || expr.compare(i, 2, "&&") == 0 || expr.compare(i, 2, "||") == 0)
+			{
+				tokens.push_back(expr.substr(i, 2));
+				i += 2;
+			}
+			else if (string("()=!&|").find(expr[i]) != string::npos)
+			{
+				tokens.push_back(expr.substr(i, 1));
+				++i;
+			}
+			else
+			{
+				size_t j = i;
+				while (j < expr.size() && !isspace(expr[j]) && string("()=!&|").find(expr[j]) == string::npos)
+					++j;
+				tokens.push_back(expr.substr(i, j - i));
+				i = j;
+			}
+		}
+	}
+
+	bool accept(const string& a, const string& b = string())
+	{
+		if (pos < tokens.size() && (iequals(tokens[pos], a) || (b.size() && iequals(tokens[pos], b))))
+		{
+			++pos;
+			return true;
+		}
+		return false;
+	}
+
+	const string& next_token(const string& what)
+	{
+		if (pos >= tokens.size())
+			fail("expected " + what + " at the end");
+		return tokens[pos++];
+	}
+
+	bitmap parse_expr()
+	{
+		auto r = parse_term();
+		while (accept("or", "||") || accept("|"))
+			r |= parse_term();
+		return r;
+	}
+
+	bitmap parse_term()
+	{
+		auto r = parse_factor();
+		while (accept("and", "&&") || accept("&"))
+			r &= parse_factor();
+		return r;
+	}
+
+	bitmap parse_factor()
+	{
+		if (accept("not", "!"))
+			return ~parse_factor();
+
+		if (accept("("))
+		{
+			auto r = parse_expr();
+			if (!accept(")"))
+				fail("expected ')'");
+			return r;
+		}
+
+		if (accept("has"))
+		{
+			if (!accept("("))
+				fail("expected '(' after 'has'");
+			auto& name = next_token("a scheme");
+			int scheme_id = match_scheme(name);
+			if (scheme_id == -1)
+				fail("unknown scheme '" + name + "'; see '--list schemes'");
+			if (!accept(")"))
+				fail("expected ')'");
+			return index.coverage[scheme_id];
+		}
+
+		auto& field = next_token("a field");
+		bool negate;
+		if (accept("="))
+			negate = false;
+		else if (accept("!="))
+			negate = true;
+		else
+			fail("expected '=' or '!=' after '" + field + "'");
+
+		auto value = next_token("a value");
+		transform(value.begin(), value.end(), value.begin(), ::toupper);
+
+		bitmap r(receptor_ids().size());
+		if (iequals(field, "species"))
+		{
+			auto it = index.species.find(value);
+			if (it == index.species.end())
+				fail("unknown species '" + value + "'");
+			r = it->second;
+		}
+		else if (iequals(field, "class"))
+		{
+			// class=B matches B1 and B2, class=B1 only itself
+			bool any = false;
+			for (auto& [cls, bits] : index.classes)
+			{
+				if (cls == value || (starts_with(cls, value) && isdigit(cls[value.size()])))
+				{
+					r |= bits;
+					any = true;
+				}
+			}
+			if (!any)
+				fail("unknown class '" + value + "'");
+		}
+		else
+		{
+			fail("unknown field '" + field + "'; use 'species', 'class' or 'has(<scheme>)'");
+		}
+		return negate ? ~r : r;
+	}
+};
+
+bitmap evaluate_filter(const string& expr)
+{
+	return filter_parser(expr).parse();
+}
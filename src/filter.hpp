@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+using namespace std;
+
+//! A fixed-size set of receptor ordinals stored as 64-bit words.
+class bitmap
+{
+public:
+	bitmap() = default;
+	explicit bitmap(size_t size, bool value = false);
+
+	void set(size_t i) { words[i >> 6] |= 1ull << (i & 63); }
+	bool test(size_t i) const { return words[i >> 6] >> (i & 63) & 1; }
+	size_t size() const { return bits; }
+	size_t count() const;
+
+	bitmap& operator&=(const bitmap& other);
+	bitmap& operator|=(const bitmap& other);
+	bitmap operator~() const;
+
+	//! Calls f with the ordinal of every set bit in ascending order.
+	template<class F>
+	void for_each(F f) const
+	{
+		for (size_t w = 0; w < words.size(); w++)
+			for (auto word = words[w]; word; word &= word - 1)
+				f((w << 6) + ctz(word));
+	}
+
+private:
+	static size_t ctz(uint64_t word);
+
+	size_t bits = 0;
+	vector<uint64_t> words;
+};
+
+//! Returns all uniprot ids in ascending order; a receptor's ordinal is its position in this list.
+const vector<string>& receptor_ids();
+
+//! Returns the ordinal of a uniprot id, or -1 if it is unknown.
+int receptor_ordinal(const string& uid);
+
+//! Evaluates a filter expression over the receptor bitmap indexes; throws runtime_error on invalid input.
+//! The grammar is:
+//!   expr    := term ('or' term)*
+//!   term    := factor ('and' factor)*
+//!   factor  := 'not' factor | '(' expr ')' | 'has' '(' scheme ')' | field ('=' | '!=') value
+//!   field   := 'species' | 'class'
+//! Values are case-insensitive; a class without subclass digits matches all of its subclasses (class=B covers B1 and B2).
+bitmap evaluate_filter(const string& expr);
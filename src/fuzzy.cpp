@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <array>
+#include "database.hpp"
+#include "fuzzy.hpp"
+using namespace std;
+
+int edit_distance(const string& a, const string& b)
+{
+	// Lowrance-Wagner: a transposition may have edits between its letters, which keeps the distance a metric that
+	// the triangle inequality pruning of the tree relies on; the matrix has a sentinel row and column of max_d
+	int rows = (int)a.size() + 2, cols = (int)b.size() + 2, max_d = (int)(a.size() + b.size());
+	vector<int> d(rows * cols);
+	auto at = [&](int i, int j) -> int& { return d[i * cols + j]; };
+	for (int i = 0; i < rows; i++)
+	{
+		at(i, 0) = max_d;
+		if (i)
+			at(i, 1) = i - 1;
+	}
+	for (int j = 0; j < cols; j++)
+	{
+		at(0, j) = max_d;
+		if (j)
+			at(1, j) = j - 1;
+	}
+
+	// the last row of a in which each letter occurs
+	array<int, 256> last_row{};
+	for (int i = 1; i <= (int)a.size(); i++)
+	{
+		int last_col = 0;
+		for (int j = 1; j <= (int)b.size(); j++)
+		{
+			int k = last_row[(unsigned char)b[j - 1]], l = last_col;
+			int cost = a[i - 1] == b[j - 1] ? 0 : 1;
+			if (!cost)
+				last_col = j;
+			at(i + 1, j + 1) = min({ at(i, j) + cost, at(i + 1, j) + 1, at(i, j + 1) + 1, at(k, l) + (i - k - 1) + 1 + (j - l - 1) });
+		}
+		last_row[(unsigned char)a[i - 1]] = i;
+	}
+	return at(rows - 1, cols - 1);
+}
+
+void bk_tree::insert(const string& key)
+{
+	if (nodes.empty())
+	{
+		nodes.push_back({ key, {} });
+		return;
+	}
+
+	for (int cur = 0;;)
+	{
+		int d = edit_distance(key, nodes[cur].key);
+		if (d == 0)
+			return;
+
+		auto& children = nodes[cur].children;
+		auto it = find_if(children.begin(), children.end(), [d](auto& c) { return c.first == d; });
+		if (it == children.end())
+		{
+			children.emplace_back(d, (int)nodes.size());
+			nodes.push_back({ key, {} });
+			return;
+		}
+		cur = it->second;
+	}
+}
+
+vector<pair<int, string>> bk_tree::search(const string& query, int max_distance) const
+{
+	vector<pair<int, string>> results;
+	if (nodes.empty())
+		return results;
+
+	vector<int> pending{ 0 };
+	while (pending.size())
+	{
+		auto& n = nodes[pending.back()];
+		pending.pop_back();
+
+		int d = edit_distance(query, n.key);
+		if (d <= max_distance)
+			results.emplace_back(d, n.key);
+
+		// triangle inequality: only subtrees at distance d +/- max_distance can hold matches
+		for (auto [cd, child] : n.children)
+			if (cd >= d - max_distance && cd <= d + max_distance)
+				pending.push_back(child);
+	}
+
+	sort(results.begin(), results.end());
+	return results;
+}
+
+vector<pair<int, string>> suggest_targets(const string& target, size_t limit)
+{
+	static table_cache<bk_tree> targets;
+	auto& index = targets.get([]
+	{
+		auto& t = tables();
+		bk_tree tree;
+		for (auto& [key, ignore] : t.uniprot_dict)
+			tree.insert(key);
+		for (auto& [key, ignore] : t.gene_name_dict)
+			tree.insert(key);
+		for (auto& [key, ignore] : t.symbol_dict)
+			tree.insert(key);
+		for (auto& [key, ignore] : t.symbol_species_dict)
+			tree.insert(key);
+		for (auto& [key, ignore] : t.pdb_id_dict)
+			tree.insert(key);
+		return tree;
+	});
+
+	// a single typo in a 4-letter pdb id is already a 25% change
+	int max_distance = target.size() <= 4 ? 1 : 2;
+
+	auto results = index.search(target, max_distance);
+	if (results.size() > limit)
+		results.resize(limit);
+	return results;
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <utility>
+using namespace std;
+
+//! Computes the Damerau-Levenshtein distance (Levenshtein with transpositions of adjacent letters) between two strings.
+int edit_distance(const string& a, const string& b);
+
+//! A Burkhard-Keller tree answering "all keys within distance d" queries without scanning every key.
+class bk_tree
+{
+public:
+	//! Adds a key to the tree; duplicate keys are ignored.
+	void insert(const string& key);
+
+	//! Returns all keys within max_distance of the query, ranked by distance and then alphabetically.
+	vector<pair<int, string>> search(const string& query, int max_distance) const;
+
+	size_t size() const { return nodes.size(); }
+
+private:
+	struct node
+	{
+		string key;
+		vector<pair<int, int>> children; // distance => node_index
+	};
+
+	vector<node> nodes;
+};
+
+//! Suggests known targets (uniprot ids, gene names, protein symbols, symbol_species and pdb ids) close to a mistyped one.
+vector<pair<int, string>> suggest_targets(const string& target, size_t limit = 5);
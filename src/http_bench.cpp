@@ -0,0 +1,218 @@
+// gpcrn-http-bench replays queries against a running gpcrn --serve over keep-alive connections and reports the
+// throughput and latency percentiles of the answers.
+#ifdef __linux__
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <boost/program_options.hpp>
+#include "server.hpp"
+#include "string.hpp"
+using namespace std;
+using namespace boost::program_options;
+
+static string url_encode(const string& s)
+{
+	const char* hex = "0123456789ABCDEF";
+	string r;
+	for (unsigned char c : s)
+	{
+		if (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~' || c == ':' || c == ',' || c == '=')
+			r += (char)c;
+		else
+		{
+			r += '%';
+			r += hex[c >> 4];
+			r += hex[c & 15];
+		}
+	}
+	return r;
+}
+
+#ifdef __linux__
+
+static int connect_to(const string& host, const string& port)
+{
+	socklen_t length;
+	auto address = parse_address(host, port, length);
+
+	int fd = socket(address.ss_family, SOCK_STREAM, 0);
+	if (fd >= 0 && connect(fd, (sockaddr*)&address, length) < 0)
+	{
+		int error = errno;
+		close(fd);
+		fd = -1;
+		errno = error;
+	}
+	if (fd < 0)
+		throw runtime_error("cannot connect to '" + host + ":" + port + "'; " + strerror(errno));
+	int one = 1;
+	setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+	return fd;
+}
+
+// sends a request and reads its response; returns the status code
+static int round_trip(int fd, const string& request, string& buffer)
+{
+	for (size_t sent = 0; sent < request.size();)
+	{
+		auto n = send(fd, request.data() + sent, request.size() - sent, MSG_NOSIGNAL);
+		if (n <= 0)
+			throw runtime_error("the server closed the connection");
+		sent += n;
+	}
+
+	char chunk[1 << 16];
+	for (;;)
+	{
+		auto header_end = buffer.find("\r\n\r\n");
+		if (header_end != string::npos)
+		{
+			auto headers = buffer.substr(0, header_end);
+			transform(headers.begin(), headers.end(), headers.begin(), ::tolower);
+			auto pos = headers.find("content-length:");
+			size_t length = pos == string::npos ? 0 : stoull(headers.substr(pos + 15));
+			if (buffer.size() >= header_end + 4 + length)
+			{
+				int status = stoi(buffer.substr(9, 3));
+				buffer.erase(0, header_end + 4 + length);
+				return status;
+			}
+		}
+		auto n = recv(fd, chunk, sizeof(chunk), 0);
+		if (n <= 0)
+			throw runtime_error("the server closed the connection");
+		buffer.append(chunk, n);
+	}
+}
+
+#endif
+
+int main(int argc, char* argv[])
+{
+	try
+	{
+		string address, file;
+		size_t requests;
+		unsigned connections;
+
+		options_description options("Options");
+		options.add_options()
+			("address,a", value<string>(&address)->value_name("HOST:PORT")->default_value("127.0.0.1:8080"), "the address of gpcrn --serve")
+			("file,f", value<string>(&file)->value_name("FILE"), "the queries to send, one per line; each is sent as GET /query?q=QUERY")
+			("requests,n", value<size_t>(&requests)->value_name("N")->default_value(100000), "the number of requests to send in total, cycling through the queries")
+			("connections,c", value<unsigned>(&connections)->value_name("N")->default_value(thread::hardware_concurrency()), "the number of keep-alive connections, each on a thread of its own sending one request at a time")
+			("help", "this help information")
+			;
+
+		variables_map vm;
+		store(parse_command_line(argc, argv, options), vm);
+		notify(vm);
+
+		if (vm.count("help") || !vm.count("file"))
+		{
+			cout << "Usage: " << argv[0] << " --file <query-file> [--address <host>:<port>] [options]" << endl;
+			cout << "Benchmarks the HTTP API of gpcrn --serve" << endl;
+			cout << options << endl;
+			return vm.count("help") ? 0 : 2;
+		}
+
+		ifstream in(file);
+		if (!in)
+		{
+			cerr << "ERROR: cannot open query file '" << file << "'" << endl;
+			return 2;
+		}
+		vector<string> queries;
+		for (string line; safe_getline(in, line);)
+			if (trim(line).size() && line[0] != '#')
+				queries.push_back("GET /query?q=" + url_encode(line) + " HTTP/1.1\r\nHost: " + address + "\r\n\r\n");
+		if (queries.empty())
+		{
+			cerr << "ERROR: no queries in '" << file << "'" << endl;
+			return 2;
+		}
+
+#ifdef __linux__
+		auto colon = address.rfind(':');
+		if (colon == string::npos)
+		{
+			cerr << "ERROR: invalid address '" << address << "'; the correct form is '<host>:<port>'" << endl;
+			return 2;
+		}
+		string host = address.substr(0, colon), port = address.substr(colon + 1);
+		connections = max(1u, connections);
+
+		// each connection takes every connections-th request and records its latencies in nanoseconds
+		vector<vector<long long>> latencies(connections);
+		atomic<size_t> failures{ 0 }, errors{ 0 };
+		vector<thread> threads;
+		auto start = chrono::steady_clock::now();
+		for (unsigned c = 0; c < connections; c++)
+		{
+			threads.emplace_back([&, c]
+			{
+				try
+				{
+					int fd = connect_to(host, port);
+					string buffer;
+					for (size_t i = c; i < requests; i += connections)
+					{
+						auto sent = chrono::steady_clock::now();
+						int status = round_trip(fd, queries[i % queries.size()], buffer);
+						latencies[c].push_back(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - sent).count());
+						if (status != 200)
+							++errors;
+					}
+					close(fd);
+				}
+				catch (exception& ex)
+				{
+					cerr << "ERROR: " << ex.what() << endl;
+					++failures;
+				}
+			});
+		}
+		for (auto& t : threads)
+			t.join();
+		double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+		vector<long long> all;
+		for (auto& l : latencies)
+			all.insert(all.end(), l.begin(), l.end());
+		sort(all.begin(), all.end());
+		if (all.empty())
+		{
+			cerr << "ERROR: no request was answered" << endl;
+			return 2;
+		}
+
+		auto percentile = [&](double p) { return all[min(all.size() - 1, (size_t)(p / 100 * all.size()))] / 1000.0; };
+		cout << "requests:    " << all.size() << " over " << connections << " connections in " << to_fixed(seconds, 3) << " s" << endl;
+		cout << "throughput:  " << to_fixed(all.size() / seconds, 0) << " requests/s" << endl;
+		cout << "non-200:     " << errors << endl;
+		cout << "latency us:  p50 " << to_fixed(percentile(50), 1) << ", p90 " << to_fixed(percentile(90), 1)
+			<< ", p99 " << to_fixed(percentile(99), 1) << ", p99.9 " << to_fixed(percentile(99.9), 1) << ", max " << to_fixed(all.back() / 1000.0, 1) << endl;
+		return failures ? 2 : 0;
+#else
+		cerr << "ERROR: the HTTP benchmark needs Linux" << endl;
+		return 2;
+#endif
+	}
+	catch (exception& ex)
+	{
+		cerr << "ERROR: " << ex.what() << endl;
+		return 2;
+	}
+}
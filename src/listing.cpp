@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <vector>
+#include "database.hpp"
+#include "listing.hpp"
+#include "string.hpp"
+using namespace std;
+
+const set<string> listing_formats
+{
+	"plain",
+	"tsv",
+	"json",
+};
+
+// a key with the ordinals of its receptors, plus the pdb ids of the receptor for receptor_pdbids
+struct listing_entry
+{
+	string key;
+	vector<int> receptors;
+	vector<string> pdb_ids;
+};
+
+using listing_entries = vector<listing_entry>;
+
+// keys are ordered and matched by their uppercase form, which is the key itself for every target kind
+static bool folded_less(const string& a, const string& b)
+{
+	return lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), [](unsigned char x, unsigned char y) { return toupper(x) < toupper(y); });
+}
+
+static bool folded_starts_with(const string& key, const string& prefix)
+{
+	return key.size() >= prefix.size() && equal(prefix.begin(), prefix.end(), key.begin(), [](unsigned char x, unsigned char y) { return toupper(x) == toupper(y); });
+}
+
+// groups the (key, uniprot id) pairs of a dictionary sorted by key into entries
+template<class Dict>
+static listing_entries group_targets(const Dict& dict)
+{
+	listing_entries entries;
+	for (auto& [key, uid] : dict)
+	{
+		int ordinal = receptor_ordinal(uid);
+		if (ordinal < 0)
+			continue;
+		if (entries.empty() || entries.back().key != key)
+			entries.push_back({ key, {}, {} });
+		entries.back().receptors.push_back(ordinal);
+	}
+	for (auto& e : entries)
+		sort(e.receptors.begin(), e.receptors.end());
+	stable_sort(entries.begin(), entries.end(), [](auto& a, auto& b) { return folded_less(a.key, b.key); });
+	return entries;
+}
+
+static listing_entries uniprot_entries()
+{
+	auto& t = tables();
+	listing_entries entries;
+	for (auto& [uid, ignore] : t.uniprot_dict)
+		entries.push_back({ uid, { receptor_ordinal(uid) }, {} });
+	return entries;
+}
+
+static listing_entries receptor_pdb_entries()
+{
+	auto& t = tables();
+	auto entries = uniprot_entries();
+	for (auto& [pdb_id, uid] : t.pdb_id_dict)
+		if (int ordinal = receptor_ordinal(uid); ordinal >= 0)
+			entries[ordinal].pdb_ids.push_back(pdb_id);
+	return entries;
+}
+
+static listing_entries label_entries(int scheme_id)
+{
+	auto& t = tables();
+	auto [offset, width, names] = t.schemes[scheme_id];
+
+	// the label of every string table row in the scheme, then a (label, receptor) pair for every numbered residue
+	vector<string> row_labels;
+	row_labels.reserve(t.string_table.size());
+	for (auto& row : t.string_table)
+		row_labels.push_back(trim(row.substr(offset, width)));
+
+	auto& ids = receptor_ids();
+	vector<pair<const string*, int>> pairs;
+	for (size_t i = 0; i < ids.size(); i++)
+	{
+		auto numbering = t.numbering_data.find(ids[i]);
+		if (numbering == t.numbering_data.end())
+			continue;
+		for (auto& [ignore, count, first] : get<3>(numbering->second))
+			for (int r = first; r < first + count; r++)
+				if (row_labels[r].size())
+					pairs.emplace_back(&row_labels[r], (int)i);
+	}
+	// labels come in natural order, as in --stats and --msa
+	sort(pairs.begin(), pairs.end(), [](auto& a, auto& b)
+	{
+		if (natural_less(*a.first, *b.first))
+			return true;
+		if (natural_less(*b.first, *a.first))
+			return false;
+		return *a.first != *b.first ? *a.first < *b.first : a.second < b.second;
+	});
+
+	listing_entries entries;
+	for (auto& [label, ordinal] : pairs)
+	{
+		if (entries.empty() || entries.back().key != *label)
+			entries.push_back({ *label, {}, {} });
+		if (entries.back().receptors.empty() || entries.back().receptors.back() != ordinal)
+			entries.back().receptors.push_back(ordinal);
+	}
+	return entries;
+}
+
+// every listing is built on first use and kept with the tables it comes from
+static const listing_entries* find_entries(const string& listing, int scheme_id)
+{
+	if (listing == "symbols")
+	{
+		static table_cache<listing_entries> entries;
+		return &entries.get([] { return group_targets(tables().symbol_dict); });
+	}
+	if (listing == "symbol_species")
+	{
+		static table_cache<listing_entries> entries;
+		return &entries.get([] { return group_targets(tables().symbol_species_dict); });
+	}
+	if (listing == "genes")
+	{
+		static table_cache<listing_entries> entries;
+		return &entries.get([] { return group_targets(tables().gene_name_dict); });
+	}
+	if (listing == "pdbids")
+	{
+		static table_cache<listing_entries> entries;
+		return &entries.get([] { return group_targets(tables().pdb_id_dict); });
+	}
+	if (listing == "uniprots")
+	{
+		static table_cache<listing_entries> entries;
+		return &entries.get([] { return uniprot_entries(); });
+	}
+	if (listing == "receptor_pdbids")
+	{
+		static table_cache<listing_entries> entries;
+		return &entries.get([] { return receptor_pdb_entries(); });
+	}
+	if (listing == "labels")
+	{
+		static array<table_cache<listing_entries>, scheme_count> entries;
+		return &entries[scheme_id].get([scheme_id] { return label_entries(scheme_id); });
+	}
+	return nullptr;
+}
+
+bool write_listing(ostream& out, const string& listing, const listing_options& opts)
+{
+	auto entries = find_entries(listing, opts.scheme_id);
+	if (!entries)
+		return false;
+
+	auto& ids = receptor_ids();
+	bool json = opts.format == "json", tsv = opts.format == "tsv", first = true;
+	vector<int> receptors;
+	if (json)
+		out << '[';
+
+	// the keys with the prefix are a run of the folded order; in the natural order of labels they are scattered
+	bool folded = listing != "labels";
+	auto it = folded ? lower_bound(entries->begin(), entries->end(), opts.prefix, [](auto& e, auto& prefix) { return folded_less(e.key, prefix); }) : entries->begin();
+	for (; it != entries->end(); ++it)
+	{
+		if (!folded_starts_with(it->key, opts.prefix))
+		{
+			if (folded)
+				break;
+			continue;
+		}
+		receptors.clear();
+		for (auto r : it->receptors)
+			if (!opts.filter || opts.filter->test(r))
+				receptors.push_back(r);
+		if (receptors.empty())
+			continue;
+
+		if (json)
+		{
+			out << (first ? "\n" : ",\n") << "{\"key\":\"" << json_escape(it->key) << "\",\"receptors\":[";
+			for (size_t i = 0; i < receptors.size(); i++)
+				out << (i ? "," : "") << '"' << ids[receptors[i]] << '"';
+			out << ']';
+			if (listing == "receptor_pdbids")
+			{
+				out << ",\"pdbids\":[";
+				for (size_t i = 0; i < it->pdb_ids.size(); i++)
+					out << (i ? "," : "") << '"' << json_escape(it->pdb_ids[i]) << '"';
+				out << ']';
+			}
+			out << '}';
+		}
+		else if (tsv)
+		{
+			out << it->key << '\t';
+			if (listing == "receptor_pdbids")
+				out << join(",", it->pdb_ids.begin(), it->pdb_ids.end());
+			else
+				for (size_t i = 0; i < receptors.size(); i++)
+					out << (i ? "," : "") << ids[receptors[i]];
+			out << '\n';
+		}
+		else
+		{
+			out << it->key << '\n';
+		}
+		first = false;
+	}
+
+	if (json)
+		out << (first ? "]\n" : "\n]\n");
+	return true;
+}
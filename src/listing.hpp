@@ -0,0 +1,23 @@
+#pragma once
+#include <ostream>
+#include <string>
+#include <set>
+#include "filter.hpp"
+using namespace std;
+
+//! The output formats of the key listings.
+extern const set<string> listing_formats;
+
+//! What a key listing shows and how.
+struct listing_options
+{
+	string prefix;                  // only keys starting with it, compared case-insensitively
+	const bitmap* filter = nullptr; // only keys of at least one receptor passing it, and only those receptors
+	int scheme_id = 0;              // the scheme whose labels are listed by the labels listing
+	string format = "plain";        // plain: keys; tsv: keys and their values; json: an array of objects
+};
+
+//! Streams a key listing to out in key order, labels in natural order: symbols, symbol_species, genes, pdbids, uniprots, the labels of a scheme
+//! with the receptors numbered by each, or receptor_pdbids with the pdb ids of each receptor.
+//! Returns false if the listing is unknown.
+bool write_listing(ostream& out, const string& listing, const listing_options& opts);
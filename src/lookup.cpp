@@ -0,0 +1,188 @@
+#include <algorithm>
+#include <climits>
+#include <unordered_map>
+#include "database.hpp"
+#include "filter.hpp"
+#include "lookup.hpp"
+#include "numbering.hpp"
+#include "string.hpp"
+using namespace std;
+
+int match_scheme(const string& s)
+{
+	auto& t = tables();
+	for (int i = 0; i < (int)t.schemes.size(); i++)
+		for (auto& name : get<2>(t.schemes[i]))
+			if (iequals(s, name))
+				return i;
+	return -1;
+}
+
+bool get_index_for_seq(const string& uniprot, int seq, int& index, char& res_name)
+{
+	auto& t = tables();
+	auto it = t.numbering_data.find(uniprot);
+	return it != t.numbering_data.end() && find_residue(it->second, seq, index, res_name);
+}
+
+// label_rows[scheme][label] => string_table indices carrying the label
+// first_seq[uniprot][string_index] => first sequence number numbered with the row, or INT_MAX
+struct label_index
+{
+	array<map<string, vector<short>>, scheme_count> label_rows;
+	map<string, vector<int>> first_seq;
+};
+
+static string fold_label(string label)
+{
+	trim(label);
+	transform(label.begin(), label.end(), label.begin(), ::tolower);
+	return label;
+}
+
+static const label_index& get_label_index()
+{
+	static table_cache<label_index> index;
+	return index.get([]
+	{
+		auto& t = tables();
+		label_index idx;
+		for (size_t s = 0; s < t.schemes.size(); s++)
+			for (size_t r = 0; r < t.string_table.size(); r++)
+				idx.label_rows[s][fold_label(t.string_table[r].substr(get<0>(t.schemes[s]), get<1>(t.schemes[s])))].push_back((short)r);
+
+		for (auto& [uid, numbering] : t.numbering_data)
+		{
+			auto& seqs = idx.first_seq[uid];
+			seqs.assign(t.string_table.size(), INT_MAX);
+			for_each_residue(numbering, [&](int seq, int index, char) { seqs[index] = min(seqs[index], seq); });
+		}
+		return idx;
+	});
+}
+
+bool get_seq_for_label(const string& uniprot, int scheme_id, const string& label, int& seq)
+{
+	auto& idx = get_label_index();
+	auto rows = idx.label_rows[scheme_id].find(fold_label(label));
+	auto seqs = idx.first_seq.find(uniprot);
+	if (rows == idx.label_rows[scheme_id].end() || seqs == idx.first_seq.end())
+		return false;
+
+	// several rows may share a label in one scheme, the lowest sequence number wins
+	seq = INT_MAX;
+	for (auto row : rows->second)
+		seq = min(seq, seqs->second[row]);
+	return seq != INT_MAX;
+}
+
+// row_class[string_index] => equivalence class, or -1 for unlabeled rows
+// classes[class] => the first residue of every receptor carrying the label, by receptor ordinal
+struct equivalence_table
+{
+	vector<int> row_class;
+	vector<vector<equivalent_residue>> classes;
+};
+
+static const equivalence_table& get_equivalence_table(int scheme_id)
+{
+	static array<table_cache<equivalence_table>, scheme_count> equivalences;
+	return equivalences[scheme_id].get([scheme_id]
+	{
+		auto& t = tables();
+		equivalence_table table;
+		auto [offset, width, names] = t.schemes[scheme_id];
+
+		// rows sharing a label form one class
+		unordered_map<string, int> label_class;
+		table.row_class.assign(t.string_table.size(), -1);
+		for (size_t r = 0; r < t.string_table.size(); r++)
+		{
+			auto label = fold_label(t.string_table[r].substr(offset, width));
+			if (label.empty())
+				continue;
+			auto [it, added] = label_class.emplace(label, (int)table.classes.size());
+			if (added)
+				table.classes.emplace_back();
+			table.row_class[r] = it->second;
+		}
+
+		// residues come in sequence order, so the first one seen per receptor is the lowest, as in get_seq_for_label()
+		auto& ids = receptor_ids();
+		for (int ordinal = 0; ordinal < (int)ids.size(); ordinal++)
+		{
+			auto it = t.numbering_data.find(ids[ordinal]);
+			if (it == t.numbering_data.end())
+				continue;
+			for_each_residue(it->second, [&](int seq, int index, char res_name)
+			{
+				if (table.row_class[index] < 0)
+					return;
+				auto& members = table.classes[table.row_class[index]];
+				if (members.empty() || members.back().receptor != ordinal)
+					members.push_back({ ordinal, seq, index, res_name });
+			});
+		}
+		return table;
+	});
+}
+
+const vector<equivalent_residue>& get_equivalent_residues(int scheme_id, int index)
+{
+	static const vector<equivalent_residue> none;
+	auto& table = get_equivalence_table(scheme_id);
+	int cls = index >= 0 && index < (int)table.row_class.size() ? table.row_class[index] : -1;
+	return cls < 0 ? none : table.classes[cls];
+}
+
+query_kind classify_numbering(const string& numbering, size_t label_width)
+{
+	if (numbering.find("->") != string::npos)
+		return query_kind::transfer;
+	if (numbering.find('=') != string::npos)
+		return query_kind::constraint;
+	if (numbering.empty())
+		return query_kind::dump;
+
+	// longer sequence numbers would overflow stoi
+	if (all_of(numbering.begin(), numbering.end(), ::isdigit))
+		return numbering.size() <= 9 ? query_kind::seq : query_kind::invalid;
+	return numbering.size() <= label_width ? query_kind::label : query_kind::invalid;
+}
+
+bool parse_constraints(const string& s, size_t label_width, vector<residue_constraint>& constraints)
+{
+	for (auto& item : split(s, ','))
+	{
+		auto eq = item.find('=');
+		if (eq == string::npos || eq == 0 || eq + 1 == item.size())
+			return false;
+
+		residue_constraint c;
+		auto position = trim(item.substr(0, eq));
+		c.residues = trim(item.substr(eq + 1));
+		transform(c.residues.begin(), c.residues.end(), c.residues.begin(), ::toupper);
+		if (!all_of(c.residues.begin(), c.residues.end(), ::isalpha))
+			return false;
+
+		auto kind = classify_numbering(position, label_width);
+		if (kind == query_kind::seq)
+			c.seq = stoi(position);
+		else if (kind == query_kind::label)
+			c.label = position;
+		else
+			return false;
+		constraints.push_back(c);
+	}
+	return constraints.size();
+}
+
+bool match_constraint(const string& uniprot, int scheme_id, const residue_constraint& constraint, int& seq, int& index, char& res_name)
+{
+	seq = constraint.seq;
+	if (seq == -1 && !get_seq_for_label(uniprot, scheme_id, constraint.label, seq))
+		return false;
+	if (!get_index_for_seq(uniprot, seq, index, res_name))
+		return false;
+	return constraint.residues.find(res_name) != string::npos;
+}
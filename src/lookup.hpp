@@ -0,0 +1,54 @@
+#pragma once
+#include <string>
+#include <vector>
+using namespace std;
+
+//! Finds the scheme whose name or any abbreviation equals s ignoring case; returns -1 if none does.
+int match_scheme(const string& s);
+
+//! Looks up the string_table index and residue name of a receptor at a residue sequence number; returns false if it is unnumbered.
+bool get_index_for_seq(const string& uniprot, int seq, int& index, char& res_name);
+
+//! Finds the first residue of a receptor numbered with a label in a scheme, compared case-insensitively; returns false if there is none.
+bool get_seq_for_label(const string& uniprot, int scheme_id, const string& label, int& seq);
+
+//! A receptor's residue equivalent to another by carrying the same label in a scheme.
+struct equivalent_residue
+{
+	int receptor; // ordinal into receptor_ids()
+	int seq;      // residue sequence number
+	int index;    // string_table index
+	char res_name;
+};
+
+//! Returns the residues equivalent to a string_table row in a scheme: in every receptor, the first residue carrying the row's
+//! label there, ordered by receptor ordinal. Empty if the row is unlabeled in the scheme. The table of a scheme is built on first use.
+const vector<equivalent_residue>& get_equivalent_residues(int scheme_id, int index);
+
+//! The forms of a query's numbering, each answered its own way.
+enum class query_kind
+{
+	seq,        // a residue sequence number
+	label,      // a residue numbering in the scheme
+	dump,       // every residue of the receptors
+	constraint, // residue constraints
+	transfer,   // an equivalent residue in other receptors
+	invalid,    // not of the form <target>:<numbering>, or a numbering of none of the forms above
+};
+
+//! Classifies a numbering by its form; sequence numbers of more than 9 digits and labels wider than label_width are invalid.
+query_kind classify_numbering(const string& numbering, size_t label_width);
+
+//! A residue identity constraint such as 3.32=D or 155=DE, requiring the residue at a position to be one of the listed ones.
+struct residue_constraint
+{
+	int seq = -1;    // residue sequence number, or -1 if the position is a label
+	string label;    // numbering label in the queried scheme
+	string residues; // allowed one-letter residue names
+};
+
+//! Parses comma-separated constraints like "3.32=D,6.48=W"; returns false if any item is malformed.
+bool parse_constraints(const string& s, size_t label_width, vector<residue_constraint>& constraints);
+
+//! Locates a constraint's position in a receptor and tests its residue; returns false if the position is unnumbered or the residue differs.
+bool match_constraint(const string& uniprot, int scheme_id, const residue_constraint& constraint, int& seq, int& index, char& res_name);
@@ -1,6 +1,8 @@
 #ifdef _WIN32
 #include <windows.h>
 #include <io.h>
+#else
+#include <unistd.h>
 #endif
 #include <iostream>
 #include <iomanip>
@@ -14,105 +16,38 @@
 #include <cctype>
 #include <fstream>
 #include <filesystem>
+#include <thread>
+#include <chrono>
+#include <sstream>
+#include <memory>
+#include <cstring>
+#include <random>
 #include <boost/program_options.hpp>
-#include "assets.hpp"
 #include "string.hpp"
+#include "answer.hpp"
+#include "api.hpp"
+#include "complete.hpp"
+#include "delta.hpp"
+#include "database.hpp"
+#include "lookup.hpp"
+#include "filter.hpp"
+#include "stats.hpp"
+#include "cache.hpp"
+#include "numbering.hpp"
+#include "scan.hpp"
+#include "pipeline.hpp"
+#include "output.hpp"
+#include "compress.hpp"
+#include "listing.hpp"
+#include "msa.hpp"
+#include "npy.hpp"
+#include "release.hpp"
+#include "metrics.hpp"
+#include "selfcheck.hpp"
 using namespace std;
 using namespace std::filesystem;
 using namespace boost::program_options;
 
-map<char, string> res_names =
-{
-	// Charged (side chains often make salt bridges},
-	{ 'R', "ARG" }, // Arginine,
-	{ 'K', "LYS" }, // Lysine,
-	{ 'D', "ASP" }, // AsparticAcid,
-	{ 'E', "GLU" }, // GlutamicAcid,
-
-	// Polar (usually participate in hydrogen bonds as proton donors or acceptors},
-	{ 'Q', "GLN" }, // Glutamine,
-	{ 'N', "ASN" }, // Asparagine,
-	{ 'H', "HIS" }, // Histidine,
-	{ 'S', "SER" }, // Serine,
-	{ 'T', "THR" }, // Threonine,
-	{ 'Y', "TYR" }, // Tyrosine,
-	{ 'C', "CYS" }, // Cysteine,
-	{ 'W', "TRP" }, // Tryptophan,
-
-	// Hydrophobic (normally buried inside the protein core},
-	{ 'A', "ALA" }, // Alanine,
-	{ 'I', "ILE" }, // Isoleucine,
-	{ 'L', "LEU" }, // Leucine,
-	{ 'M', "MET" }, // Methionine,
-	{ 'F', "PHE" }, // Phenylalanine,
-	{ 'V', "VAL" }, // Valine,
-	{ 'P', "PRO" }, // Proline,
-	{ 'G', "GLY" }, // Glycine
-};
-
-enum class headers
-{
-	symbol,
-	gene,
-	uniprot,
-	residue,
-	sequence,
-	numbering,
-};
-
-array<pair<int, string>, 6> header_fmts =
-{ {
-	{ 14, "Protein" },
-	{ 9,  "Gene" },
-	{ 10, "Uniprot" },
-	{ 5,  "Res" },
-	{ 6,  "Seq" },
-	{ 0,  "Numbering" },
-} };
-
-// see https://en.wikipedia.org/wiki/ANSI_escape_code#Colors
-enum class fgcolor
-{
-	none    = 0,
-	black   = 30, // Black   30 40
-	red     = 31, // Red     31 41
-	green   = 32, // Green   32 42
-	yellow  = 33, // Yellow  33 43
-	blue    = 34, // Blue    34 44
-	magenta = 35, // Magenta 35 45
-	cyan    = 36, // Cyan    36 46
-	white   = 37, // White   37 47
-	bright_black   = 90, // Bright Black   90 100
-	bright_red     = 91, // Bright Red     91 101
-	bright_green   = 92, // Bright Green   92 102
-	bright_yellow  = 93, // Bright Yellow  93 103
-	bright_blue    = 94, // Bright Blue    94 104
-	bright_magenta = 95, // Bright Magenta 95 105
-	bright_cyan    = 96, // Bright Cyan    96 106
-	bright_white   = 97, // Bright White   97 107
-};
-
-enum class bgcolor
-{
-	none    = 0,
-	black   = 40, // Black   30 40
-	red     = 41, // Red     31 41
-	green   = 42, // Green   32 42
-	yellow  = 43, // Yellow  33 43
-	blue    = 44, // Blue    34 44
-	magenta = 45, // Magenta 35 45
-	cyan    = 46, // Cyan    36 46
-	white   = 47, // White   37 47
-	bright_black   = 100, // Bright Black   90 100
-	bright_red     = 101, // Bright Red     91 101
-	bright_green   = 102, // Bright Green   92 102
-	bright_yellow  = 103, // Bright Yellow  93 103
-	bright_blue    = 104, // Bright Blue    94 104
-	bright_magenta = 105, // Bright Magenta 95 105
-	bright_cyan    = 106, // Bright Cyan    96 106
-	bright_white   = 107, // Bright White   97 107
-};
-
 set<string> colorings
 {
 	"always",
@@ -120,6 +55,13 @@ set<string> colorings
 	"never",
 };
 
+set<string> io_backends
+{
+	"iostream",
+	"write",
+	"uring",
+};
+
 set<string> listings
 {
 	"schemes",
@@ -129,6 +71,9 @@ set<string> listings
 	"genes",
 	"pdbids",
 	"uniprots",
+	"labels",
+	"receptor_pdbids",
+	"releases",
 };
 
 #ifdef _WIN32
@@ -167,47 +112,12 @@ void init_console_coloring()
 
 #endif
 
-template <class _Traits>
-inline basic_ostream<char, _Traits>& operator<<(basic_ostream<char, _Traits>& _Ostr,
-	const fgcolor& color)
-{
-	return _Ostr << "\x1b[" << (int)color << "m";
-}
-
-bool iequals(const string& a, const string& b)
-{
-	for (size_t i = 0; i < a.size() || i < b.size(); ++i)
-	{
-		if (i >= a.size())
-		{
-			if (!isspace(b[i])) return false;
-		}
-		else if (i >= b.size())
-		{
-			if (!isspace(a[i])) return false;
-		}
-		else if (tolower(a[i]) != tolower(b[i]))
-		{
-			return false;
-		}
-	}
-	return true;
-}
-
-int match_scheme(const string& s)
-{
-	for (int i = 0; i < (int)schemes.size(); i++)
-		for (auto& name : get<2>(schemes[i]))
-			if (iequals(s, name))
-				return i;
-	return -1;
-}
-
 void supported_schemes(const string& default_scheme)
 {
+	auto& t = tables();
 	cout << "Supported schemes:" << endl;
 
-	for (auto [offset, width, abbrs] : schemes)
+	for (auto [offset, width, abbrs] : t.schemes)
 	{
 		bool first = true;
 		string s;
@@ -224,230 +134,6 @@ void supported_schemes(const string& default_scheme)
 	}
 }
 
-bool get_index_for_seq(const string& uniprot, int seq, int& index, char& res_name)
-{
-	auto [min_seq, res_count, res_names, numbering] = numbering_data[uniprot];
-	if (seq < min_seq || seq >= min_seq + res_count || numbering[seq - min_seq] == -1)
-		return false;
-	index = numbering[seq - min_seq];
-	res_name = res_names[seq - min_seq];
-	return true;
-}
-
-void output_line(const array<bool, header_fmts.size()>& no_cols, int last_col, const string& scheme)
-{
-	for (int i = 0; i < (int)header_fmts.size(); i++)
-	{
-		if (no_cols[i])
-			continue;
-		if (i != last_col)
-			cout << left << setw(header_fmts[i].first);
-		cout << header_fmts[i].second;
-		if (i == last_col)
-			cout << endl;
-	}
-}
-
-void output_line(const array<bool, header_fmts.size()>& no_cols, int last_col, const array<bool, header_fmts.size()>& highlights, const string& uniprot, const string& seq, const string& numbering, const char& res_name, fgcolor hlcolor)
-{
-	auto [symbol, species, gene_name, long_species] = uniprot_dict[uniprot];
-
-	vector<string> fields
-	{
-		symbol + '_' + species,
-		gene_name,
-		uniprot,
-		res_names.count(res_name) ? res_names[res_name] : "?",
-		res_names.count(res_name) ? res_name + seq : "?" + seq,
-		numbering,
-	};
-
-	for (int i = 0; i < (int)header_fmts.size(); i++)
-	{
-		if (no_cols[i])
-			continue;
-		if (highlights[i] && hlcolor != fgcolor::none)
-			cout << hlcolor;
-		if (i != last_col)
-			cout << left << setw(header_fmts[i].first);
-		cout << fields[i];
-		if (highlights[i] && hlcolor != fgcolor::none)
-			cout << fgcolor::none;
-		if (i == last_col)
-			cout << endl;
-	}
-}
-
-int process(const array<bool, header_fmts.size()>& no_cols, int last_col, bool no_headers, bool show_unmatched, int scheme_id, int& line_no, const string& query, fgcolor hlcolor)
-{
-	smatch ms;
-	if (!regex_match(query, ms, regex("([^:]*):(.*)")))
-	{
-		cerr << "ERROR: invalid query '" << query << "'; the correct form is '<target>:<numbering>'" << endl;
-		return 2;
-	}
-
-	string target = ms[1].str(), numbering = ms[2].str();
-
-	if (target.empty() && numbering.empty())
-	{
-		cerr << "ERROR: invalid query '" << query << "'; at least a target or a numbering is required" << endl;
-		return 2;
-	}
-
-	vector<string> uids;
-	transform(target.begin(), target.end(), target.begin(), ::toupper);
-	transform(numbering.begin(), numbering.end(), numbering.begin(), ::tolower);
-
-	array<bool, header_fmts.size()> highlights{};
-
-	// only target is blank
-	if (target.empty())
-	{
-		for (auto [uid, pn] : uniprot_dict)
-			uids.push_back(uid);
-	}
-	// uniprot_id: P28223
-	// species: Human
-	else if (uniprot_dict.count(target))
-	{
-		highlights[(int)headers::uniprot] = true;
-		uids.push_back(target);
-	}
-	// pdb_id: 6A93
-	else if (pdb_id_dict.count(target)) // unique
-	{
-		//highlights[(int)headers::pdbid] = true;
-		uids.push_back(pdb_id_dict[target]);
-	}
-	// gene name: HTR2A
-	else if (gene_name_dict.count(target)) // could be multiple
-	{
-		highlights[(int)headers::gene] = true;
-		auto [lo, hi] = gene_name_dict.equal_range(target);
-		for (; lo != hi; ++lo)
-			uids.push_back(lo->second);
-	}
-	// protein_symbol_species: 5HT2A_HUMAN
-	else if (symbol_species_dict.count(target)) // unique
-	{
-		highlights[(int)headers::symbol] = true;
-		uids.push_back(symbol_species_dict[target]);
-	}
-	// protein_symbol: 5HT2A
-	else if (symbol_dict.count(target)) // could be multiple
-	{
-		highlights[(int)headers::symbol] = true;
-		auto [lo, hi] = symbol_dict.equal_range(target);
-		for (; lo != hi; ++lo)
-			uids.push_back(lo->second);
-	}
-	else
-	{
-		cerr << "ERROR: unknown target '" << ms[1].str() << "'; use uniprot id, gene name, protein symbol or pdb id for a GPCR" << endl;
-		return 2;
-	}
-
-	auto [offset, width, names] = schemes[scheme_id];
-
-	// all residue numberings
-	if (numbering.empty())
-	{
-		if (!no_headers && !line_no)
-		{
-			output_line(no_cols, last_col, names[1]);
-			++line_no;
-		}
-		for (auto& uid : uids)
-		{
-			auto [min_seq, seq_count, seq_names, numbering] = numbering_data[uid];
-			for (int seq = min_seq; seq < min_seq + seq_count; seq++)
-			{
-				int stridx;
-				char res_name;
-				if (get_index_for_seq(uid, seq, stridx, res_name))
-				{
-					output_line(no_cols, last_col, highlights, uid, to_string(seq), string_table[stridx].substr(offset, width), res_name, hlcolor);
-					++line_no;
-				}
-			}
-		}
-	}
-	// numbering is a residue sequence
-	else if (count_if(numbering.begin(), numbering.end(), ::isdigit) == (int)numbering.size())
-	{
-		highlights[(int)headers::sequence] = true;
-		if (!no_headers && !line_no)
-		{
-			output_line(no_cols, last_col, names[1]);
-			++line_no;
-		}
-		int seq = stoi(numbering);
-		for (auto& uid : uids)
-		{
-			int stridx;
-			char res_name;
-			if (get_index_for_seq(uid, seq, stridx, res_name))
-			{
-				output_line(no_cols, last_col, highlights, uid, to_string(seq), string_table[stridx].substr(offset, width), res_name, hlcolor);
-				++line_no;
-			}
-			else if (show_unmatched)
-			{
-				output_line(no_cols, last_col, highlights, uid, to_string(seq), "?", '?', hlcolor);
-				++line_no;
-			}
-		}
-	}
-	// numbering is a residue numbering
-	else if (numbering.size() <= width)
-	{
-		highlights[(int)headers::numbering] = true;
-		if (!no_headers && !line_no)
-		{
-			output_line(no_cols, last_col, names[1]);
-			++line_no;
-		}
-		for (auto& uid : uids)
-		{
-			auto [min_seq, seq_count, seq_names, numbering2] = numbering_data[uid];
-			bool hit = false;
-
-			for (int seq = min_seq; seq < min_seq + seq_count; seq++)
-			{
-				int stridx;
-				char res_name;
-				if (!get_index_for_seq(uid, seq, stridx, res_name))
-					continue;
-
-				auto str = string_table[stridx].substr(offset, width);
-				hit = iequals(str, numbering);
-
-				if (hit)
-				{
-					output_line(no_cols, last_col, highlights, uid, to_string(seq), str, res_name, hlcolor);
-					++line_no;
-					break;
-				}
-			}
-
-			if (!hit && show_unmatched)
-			{
-				output_line(no_cols, last_col, highlights, uid, "?", ms[2].str(), '?', hlcolor);
-				++line_no;
-			}
-		}
-	}
-	// unknown numbering
-	else
-	{
-		cerr << "ERROR: invalid numbering '" << ms[2].str() << "' for scheme '" << names[0] << "'" << endl;
-		return 2;
-	}
-
-	return 0;
-}
-
 string formatter(const set<string>& set)
 {
 	string r;
@@ -471,25 +157,52 @@ string formatter(const set<string>& set)
 	return r;
 }
 
-int main(int argc, char* argv[])
+// writes the steady clock when main is entered to the file descriptor in GPCRN_STARTUP_FD, so that
+// gpcrn-startup-bench can tell the time spent before main, such as building the tables of assets.cpp
+void report_startup()
+{
+#ifndef _WIN32
+	auto fd = getenv("GPCRN_STARTUP_FD");
+	if (!fd)
+		return;
+	auto now = to_string(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count());
+	if (write(atoi(fd), now.data(), now.size()) < 0)
+		return;
+#endif
+}
+
+// runs the command line; the output backend it opens is closed by main() once everything is written
+int run(int argc, char* argv[], unique_ptr<output_backend>& backend)
 {
-	static string default_scheme = "BW", default_coloring = "auto";
+	static string default_scheme = "BW", default_coloring = "auto", version = "1.0.8 (2021-06-02)";
 	static fgcolor default_hlcolor = fgcolor::bright_red;
 
 	try
 	{
 		vector<string> queries;
-		path file;
-		string scheme, listing, coloring;
-		bool no_headers, show_unmatched, ignore_errors;
+		path file, assets_dir, database_file, output_file, npy_file, releases_dir, metrics_file;
+		vector<path> deltas;
+		string scheme, listing, list_prefix, list_format, msa_format, npy_emit_name, release, diff_release, coloring, shell, complete_word, where, io_backend, serve, shm;
+		bool no_headers, show_unmatched, ignore_errors, fuzzy, stats, cache_stats, plan;
+		size_t cache_mb, batch;
+		unsigned flush_latency, workers, shm_channels, seed;
+		size_t check_queries;
 		array<bool, header_fmts.size()> no_cols{};
 		fgcolor hlcolor = fgcolor::none;
 
 		options_description input_options("Input options");
 		input_options.add_options()
-			("query,q", value<vector<string>>(&queries)->value_name("QUERY ..."), "a list of case-insensitive queries; QUERY must be in the format of <target>:<numbering> where <target> is any of: uniprot id, gene name, protein symbol or pdb id, <numbering> is either a residue sequence number or a residue numbering in the scheme specified by --scheme argument")
-			("file,f", value<path>(&file)->value_name("FILE"), "use queries in the specified file")
+			("query,q", value<vector<string>>(&queries)->value_name("QUERY ..."), "a list of case-insensitive queries; QUERY must be in the format of <target>:<numbering> where <target> is any of: uniprot id, gene name, protein symbol or pdb id, <numbering> is either a residue sequence number or a residue numbering in the scheme specified by --scheme argument; <target>:<numbering>->[<target>,...] gives the equivalent residues in the listed receptors, or in all of them if none is listed")
+			("file,f", value<path>(&file)->value_name("FILE"), "use queries in the specified file, which may be compressed with gzip or zstd")
 			("scheme,s", value<string>(&scheme)->default_value(default_scheme)->value_name("KEYWORD"), "a case-insensitive keyword to match a GPCR numbering scheme; supported schemes are listed with --list schemes")
+			("database", value<path>(&database_file)->value_name("FILE"), "use a binary database written by gpcrn-build instead of the built-in one; defaults to the GPCRN_DATABASE environment variable")
+			("release", value<string>(&release)->value_name("NAME"), "use a release from the releases directory, named by its file name without .db or by its GPCRdb version, or 'builtin'; see them with --list releases")
+			("releases", value<path>(&releases_dir)->value_name("DIR"), "the directory of release databases written by gpcrn-build, each named <name>.db; defaults to the GPCRN_RELEASES environment variable")
+			("delta", value<vector<path>>(&deltas)->value_name("FILE"), "apply a delta file on top of the built-in database; may be repeated and is applied in order; defaults to the GPCRN_DELTA environment variable")
+			("where,w", value<string>(&where)->value_name("EXPR"), "only match receptors selected by a filter expression, e.g. 'species=HUMAN and class=A and has(GA)'; fields are species and class, has(<scheme>) tests scheme coverage; combine with and, or, not and parentheses")
+			("plan", bool_switch(&plan), "answer queries in blocks of 4096 grouped by receptor, resolving and scanning each receptor once per block; answers keep the input order")
+			("batch", value<size_t>(&batch)->default_value(256)->value_name("N"), "hand queries read from a file or stdin to the lookups in batches of up to N lines, or 4096 with --plan; a batch is handed on early whenever the input pauses")
+			("fuzzy", bool_switch(&fuzzy), "resolve an unknown target to its closest known target when the match is unambiguous")
 			;
 
 		options_description output_options("Output options");
@@ -501,20 +214,50 @@ int main(int argc, char* argv[])
 			(",5", bool_switch(&no_cols[4]), "suppress column 5 (Residue Sequence)")
 			(",6", bool_switch(&no_cols[5]), "suppress column 6 (Residue Numbering)")
 			("color", value<string>(&coloring)->value_name("WHEN")->default_value(default_coloring), ("colorize the output; WHEN can be " + formatter(colorings) + "; default to 'auto' if omitted").c_str())
+			("output,o", value<path>(&output_file)->value_name("FILE"), "write the output into FILE instead of stdout, compressed with gzip or zstd if FILE ends in .gz or .zst")
 			("hide-headers,H", bool_switch(&no_headers), "do not display headers on the first line")
+			("npy", value<path>(&npy_file)->value_name("FILE"), "instead of residues, annotate a .npy array of integer sequence numbers of the receptor named by the only query, writing a .npy array of the same shape into --output")
+			("npy-emit", value<string>(&npy_emit_name)->value_name("WHAT")->default_value("index"), "what --npy writes per sequence number: 'index' for int16 string table indices, -1 if unnumbered, or 'label' for the fixed-width labels of --scheme")
+			("diff", value<string>(&diff_release)->value_name("RELEASE"), "instead of residues, list the differences from RELEASE to the database in use, one per line: version, +receptor, -receptor, ~receptor, +pdb, -pdb, ~pdb, ~residue and ~label in --scheme")
+			("msa", value<string>(&msa_format)->value_name("FMT"), ("instead of residues, output the alignment of the receptors selected by the queries, or all receptors if none is given, with a column per label of --scheme; FMT can be " + formatter(msa_formats) + " and a query is only a target here").c_str())
+			("stats", bool_switch(&stats), "instead of residues, output residue frequencies, entropy and coverage per numbering over the receptors selected by the queries, or all receptors if none is given")
 			("show-unmatched,u", bool_switch(&show_unmatched), "output unmatched numberings as well (will be labeled with a question mark ?)")
 			("ignore-errors,E", bool_switch(&ignore_errors), "ignore errors and move on to the next query")
+			("io-backend", value<string>(&io_backend)->value_name("NAME")->default_value("iostream"), ("write answers through " + formatter(io_backends) + "; write hands 1 MB buffers to write(2), uring formats the next buffer while Linux io_uring writes the last one and falls back to write elsewhere").c_str())
+			("flush-latency", value<unsigned>(&flush_latency)->default_value(0)->value_name("USEC"), "when answering queries from a file or stdin, let answers wait up to USEC microseconds to be written together; 0 writes them as soon as the lookups catch up with the input")
 			;
 
 		options_description misc_options("Misc options");
 		misc_options.add_options()
-			("list,L", value<string>(&listing)->value_name("TYPE"), ("show a supported list; TYPE can be " + formatter(listings)).c_str())
+			("list,L", value<string>(&listing)->value_name("TYPE"), ("show a supported list; TYPE can be " + formatter(listings) + "; labels are those of --scheme, and --where, --output, --prefix and --format apply").c_str())
+			("prefix", value<string>(&list_prefix)->value_name("P"), "only list keys starting with P, compared case-insensitively")
+			("format", value<string>(&list_format)->value_name("FMT")->default_value("plain"), ("the format of --list; FMT can be " + formatter(listing_formats) + "; tsv adds the receptors of each key, or the pdb ids of each receptor, and json gives an array of objects").c_str())
+			("cache", value<size_t>(&cache_mb)->default_value(64)->value_name("MB"), "keep the output of up to MB megabytes of distinct queries in memory so that repeated queries are answered without a lookup; 0 disables the cache")
+			("cache-stats", bool_switch(&cache_stats), "report cache hits and misses on stderr when all queries are done")
+			("metrics", value<path>(&metrics_file)->value_name("FILE"), "count the queries, rows and latencies and write them in the Prometheus text format into FILE when all queries are done and on every SIGUSR1")
+			("serve", value<string>(&serve)->value_name("[HOST:]PORT"), "answer queries over HTTP on PORT of HOST, 127.0.0.1 by default, instead: GET /query?q=QUERY, POST /batch with a JSON array of queries or one query per line, GET /health, GET /metrics in the Prometheus text format, and POST /reload or SIGHUP to reload the database and deltas; answers are JSON")
+			("workers", value<unsigned>(&workers)->default_value(thread::hardware_concurrency())->value_name("N"), "the number of threads serving HTTP connections")
+			("shm", value<string>(&shm)->value_name("NAME"), "answer binary query records from clients on this host through the shared memory segment /NAME instead; see src/shm.hpp for the layout and the client")
+			("shm-channels", value<unsigned>(&shm_channels)->default_value(8)->value_name("N"), "the number of clients the shared memory segment serves at once")
+			("self-check", value<size_t>(&check_queries)->implicit_value(10000)->value_name("N"), "diff the answers of the optimized lookup paths against a plain reference for every target kind and scheme, with and without -u and column suppression, plus N random queries (10000 if omitted); --where applies")
+			("seed", value<unsigned>(&seed)->value_name("S"), "the seed of the random queries of --self-check, drawn at random if omitted; the self-check reports it either way")
+			("write-assets", value<path>(&assets_dir)->value_name("DIR"), "write the database with all deltas applied as assets.hpp and assets.cpp into DIR")
+			("completion", value<string>(&shell)->value_name("SHELL"), "print a completion script for SHELL, which can be 'bash' or 'zsh'")
 			("help", "this help information")
 			("version", "version information")
 			;
 
+		// used by the generated completion scripts only
+		options_description hidden_options;
+		hidden_options.add_options()
+			("complete", value<string>(&complete_word))
+			;
+
+		options_description visible_options;
+		visible_options.add(input_options).add(output_options).add(misc_options);
+
 		options_description all_options;
-		all_options.add(input_options).add(output_options).add(misc_options);
+		all_options.add(visible_options).add(hidden_options);
 
 		positional_options_description positional;
 		positional.add("query", -1);
@@ -529,7 +272,7 @@ int main(int argc, char* argv[])
 			cout << "       " << argv[0] << " --file <query-file> [options]" << endl;
 			cout << "GPCR numbering tool by Maozi Chen" << endl;
 			cout << "All data are downloaded from https://GPCRdb.org/structure/" << endl;
-			cout << all_options << endl;
+			cout << visible_options << endl;
 			cout << "Examples:" << endl;
 			cout << "  " << argv[0] << " 5HT2A:123     \tGet BW numbering for protein 5HT2A at 123." << endl;
 			cout << "  " << argv[0] << " HTR2A:123     \tGet BW numbering for gene HTR2A at 123." << endl;
@@ -540,66 +283,75 @@ int main(int argc, char* argv[])
 			cout << "  " << argv[0] << " HTR2A:        \tGet all BW numberings for gene HTR2A." << endl;
 			cout << "  " << argv[0] << " :2.53         \tGet residue sequence numbers for all GPCR at BW 2.53." << endl;
 			cout << "  " << argv[0] << " HTR2A:123 -sWB\tGet Wootten numberings for gene HTR2A at 123." << endl;
+			cout << "  " << argv[0] << " :3.32=D,6.48=W\tGet residues for all GPCRs with ASP at BW 3.32 and TRP at BW 6.48." << endl;
+			cout << "  " << argv[0] << " :3.50 --stats\tGet residue frequencies at BW 3.50 across all GPCRs." << endl;
+			cout << "  " << argv[0] << " :3.50 -w 'species=HUMAN and class=B'\tGet residues at BW 3.50 for all human class B GPCRs." << endl;
 			return 0;
 		}
 
-		if (vm.count("list"))
+		if (vm.count("release") && vm.count("database"))
 		{
-			if (!listings.count(listing))
+			cerr << "ERROR: --release and --database both choose the database; use one of them" << endl;
+			return 2;
+		}
+		if (database_file.empty() && !vm.count("release") && getenv("GPCRN_DATABASE"))
+			database_file = getenv("GPCRN_DATABASE");
+		if (releases_dir.empty() && getenv("GPCRN_RELEASES"))
+			releases_dir = getenv("GPCRN_RELEASES");
+
+		// the base of a diff is read while the built-in tables are still loaded, in case it is them, and the set of them
+		// is kept only for a server to reload from
+		auto builtin = latest_tables();
+		auto builtin_version = builtin->version;
+		database_tables diff_base;
+		if (vm.count("diff"))
+			diff_base = load_release(releases_dir, diff_release);
+		if (!vm.count("serve"))
+			builtin.reset();
+
+		// deltas apply on top of the chosen database
+		if (vm.count("release"))
+			use_tables(load_release(releases_dir, release));
+		else if (!database_file.empty())
+			read_database(database_file);
+
+		if (deltas.empty() && getenv("GPCRN_DELTA"))
+			deltas.push_back(getenv("GPCRN_DELTA"));
+
+		for (auto& delta : deltas)
+		{
+			ifstream in(delta);
+			if (!in)
 			{
-				cerr << "ERROR: unrecognized argument '" << listing << "'; use " << formatter(listings) << endl;
+				cerr << "ERROR: cannot open delta file '" << delta.string() << "'" << endl;
 				return 2;
 			}
+			apply_delta(in, delta.string());
+		}
 
-			if (listing == "schemes")
-			{
-				supported_schemes(default_scheme);
-			}
-			else if (listing == "residues")
-			{
-				for (auto [abbr, name] : res_names)
-					cout << abbr << '\t' << name << endl;
-			}
-			else
+		if (vm.count("write-assets"))
+		{
+			write_assets(assets_dir);
+			return 0;
+		}
+
+		if (vm.count("completion"))
+		{
+			auto script = completion_script(shell, path(argv[0]).filename().string(), listings);
+			if (script.empty())
 			{
-				set<string> results;
-				if (listing == "symbol_species")
-				{
-					for (auto [key, ignore] : symbol_species_dict)
-						results.insert(key);
-				}
-				else if (listing == "genes")
-				{
-					for (auto [key, ignore] : gene_name_dict)
-						results.insert(key);
-				}
-				else if (listing == "symbols")
-				{
-					for (auto [key, ignore] : symbol_dict)
-						results.insert(key);
-				}
-				else if (listing == "pdbids")
-				{
-					for (auto [key, ignore] : pdb_id_dict)
-						results.insert(key);
-				}
-				else if (listing == "uniprots")
-				{
-					for (auto [key, ignore] : uniprot_dict)
-						results.insert(key);
-				}
-
-				for (auto& s : results)
-					cout << s << endl;
+				cerr << "ERROR: unrecognized argument '" << shell << "'; use 'bash' or 'zsh'" << endl;
+				return 2;
 			}
-
+			cout << script;
 			return 0;
 		}
 
 		if (vm.count("version"))
 		{
-			cout << "gpcrn version: 1.0.8 (2021-06-02)" << endl;
-			cout << "GPCRdb version: 2021-05-14" << endl;
+			cout << "gpcrn version: " << version << endl;
+			cout << "GPCRdb version: " << tables().version << endl;
+			cout << "Label scan kernel: " << scan_kernel() << endl;
 			return 0;
 		}
 
@@ -608,13 +360,20 @@ int main(int argc, char* argv[])
 		if (scheme_id == -1)
 		{
 			set<string> keywords;
-			for (auto [ignore, also_ignore, abbrs] : schemes)
+			for (auto [ignore, also_ignore, abbrs] : tables().schemes)
 				keywords.insert(abbrs[1]);
 			cerr << "ERROR: unrecognized argument '" << scheme << "'; use " << formatter(keywords) << "; see more with '--list schemes'" << endl;
 			return 2;
 		}
 
-		header_fmts.back().second = (get<2>(schemes[scheme_id]))[1];
+		header_fmts.back().second = (get<2>(tables().schemes[scheme_id]))[1];
+
+		if (vm.count("complete"))
+		{
+			for (auto& candidate : complete_query(complete_word, scheme_id))
+				cout << candidate << '\n';
+			return 0;
+		}
 
 		// apply coloring config
 		if (!colorings.count(coloring))
@@ -623,7 +382,7 @@ int main(int argc, char* argv[])
 			return 2;
 		}
 
-		if (coloring == "always" || (coloring == "auto" && !is_redirected(stdout)))
+		if (coloring == "always" || (coloring == "auto" && output_file.empty() && !is_redirected(stdout)))
 		{
 			hlcolor = default_hlcolor;
 			init_console_coloring();
@@ -635,52 +394,216 @@ int main(int argc, char* argv[])
 			if (!no_cols[last_col])
 				break;
 
-		// start running
-		int line_no = 0;
-		bool any = false;
-		if (queries.size())
+		// evaluate the receptor filter once for all queries
+		bitmap selected;
+		const bitmap* filter = nullptr;
+		if (vm.count("where"))
+		{
+			selected = evaluate_filter(where);
+			filter = &selected;
+		}
+
+		// the array goes straight into the output file, without the output backend
+		if (vm.count("npy"))
 		{
+			if (npy_emit_name != "index" && npy_emit_name != "label")
+			{
+				cerr << "ERROR: unrecognized argument '" << npy_emit_name << "'; use 'index' or 'label'" << endl;
+				return 2;
+			}
+			if (queries.size() != 1 || output_file.empty())
+			{
+				cerr << "ERROR: --npy needs one query naming the receptor and an --output file" << endl;
+				return 2;
+			}
+
+			auto shown = trim(queries[0].substr(0, queries[0].find(':'))), target = shown;
+			transform(target.begin(), target.end(), target.begin(), ::toupper);
+			vector<string> uids;
+			array<bool, header_fmts.size()> highlights{};
+			if (!select_receptors(target, shown, fuzzy, nullptr, uids, highlights, cerr))
+				return 2;
+			if (uids.size() != 1)
+			{
+				cerr << "ERROR: ambiguous target '" << shown << "' of " << uids.size() << " receptors; use one of " << join(", ", uids.begin(), uids.end()) << endl;
+				return 2;
+			}
+
+			annotate_npy(npy_file, output_file, uids[0], scheme_id, npy_emit_name == "label" ? npy_emit::label : npy_emit::index);
+			return 0;
+		}
+
+		if (!io_backends.count(io_backend))
+		{
+			cerr << "ERROR: unrecognized argument '" << io_backend << "'; use " << formatter(io_backends) << endl;
+			return 2;
+		}
+
+		// piped queries are read and answered on threads of their own, which needs the streams to have their own buffers
+		if (!stats && queries.empty() && !vm.count("file") && is_redirected(stdin))
+			ios::sync_with_stdio(false);
+
+		backend = make_unique<output_backend>(io_backend, output_file);
+		if (backend->fallback())
+			cerr << "WARNING: io_uring is unavailable; writing with write(2) instead" << endl;
+
+		if (vm.count("list"))
+		{
+			if (!listings.count(listing))
+			{
+				cerr << "ERROR: unrecognized argument '" << listing << "'; use " << formatter(listings) << endl;
+				return 2;
+			}
+			if (!listing_formats.count(list_format))
+			{
+				cerr << "ERROR: unrecognized argument '" << list_format << "'; use " << formatter(listing_formats) << endl;
+				return 2;
+			}
+
+			if (listing == "schemes")
+			{
+				supported_schemes(default_scheme);
+			}
+			else if (listing == "residues")
+			{
+				for (auto [abbr, name] : res_names)
+					cout << abbr << '\t' << name << '\n';
+			}
+			else if (listing == "releases")
+			{
+				for (auto& [name, version] : find_releases(releases_dir, builtin_version))
+					cout << name << '\t' << version << '\n';
+			}
+			else
+			{
+				write_listing(cout, listing, { list_prefix, filter, scheme_id, list_format });
+			}
+			return 0;
+		}
+
+		if (vm.count("diff"))
+		{
+			auto changes = write_release_diff(cout, diff_base, loaded_tables(), scheme_id);
+			cerr << "INFO: " << changes << " differences from '" << diff_release << "' (" << diff_base.version << ") to " << tables().version << endl;
+			return 0;
+		}
+
+		if (vm.count("msa"))
+		{
+			if (!msa_formats.count(msa_format))
+			{
+				cerr << "ERROR: unrecognized argument '" << msa_format << "'; use " << formatter(msa_formats) << endl;
+				return 2;
+			}
+			if (vm.count("file"))
+			{
+				auto in = open_input(file);
+				for (string line; safe_getline(*in, line);)
+					if (trim(line).size() && line[0] != '#')
+						queries.push_back(line);
+			}
+
+			// each receptor once, in the order the queries name them
+			vector<string> uids;
+			array<bool, header_fmts.size()> highlights{};
+			if (queries.empty())
+				select_receptors("", "", fuzzy, filter, uids, highlights, cerr);
 			for (auto& query : queries)
 			{
-				int retcode = process(no_cols, last_col, no_headers, show_unmatched, scheme_id, line_no, query, hlcolor);
-				if (!ignore_errors && retcode)
-					return retcode;
+				auto shown = trim(query.substr(0, query.find(':'))), target = shown;
+				transform(target.begin(), target.end(), target.begin(), ::toupper);
+				if (!select_receptors(target, shown, fuzzy, filter, uids, highlights, cerr))
+					return 2;
 			}
-			any = true;
+			vector<int> receptors;
+			set<int> seen;
+			for (auto& uid : uids)
+				if (seen.insert(receptor_ordinal(uid)).second)
+					receptors.push_back(receptor_ordinal(uid));
+
+			write_msa(cout, msa_format, scheme_id, receptors);
+			return 0;
 		}
 
-		if (vm.count("file"))
+		if (stats)
 		{
-			ifstream in(file);
-			for (string line; safe_getline(in, line);)
+			if (vm.count("file"))
 			{
-				trim(line);
-				if (line.empty() || line[0] == '#')
-					continue;
-				int retcode = process(no_cols, last_col, no_headers, show_unmatched, scheme_id, line_no, line, hlcolor);
-				if (!ignore_errors && retcode)
-					return retcode;
+				auto in = open_input(file);
+				for (string line; safe_getline(*in, line);)
+					if (trim(line).size() && line[0] != '#')
+						queries.push_back(line);
 			}
-			any = true;
+			return output_stats(queries, no_headers, fuzzy, filter, scheme_id);
 		}
 
-		if (!any)
+		query_options opts{ no_cols, last_col, no_headers, show_unmatched, fuzzy, filter, scheme_id, hlcolor, false, "" };
+
+		// every setting above changes the output, so all of them are part of the cache keys
+		opts.cache_context = settings_key(opts);
+
+		unique_ptr<result_cache> cache;
+		if (cache_mb)
+			cache = make_unique<result_cache>(cache_mb << 20);
+
+		if (vm.count("self-check"))
+			return self_check(filter, check_queries, vm.count("seed") ? seed : random_device()());
+
+		// the HTTP API shares the lookups and the cache with the command line, under keys of its own
+		// the resident modes count their queries for GET /metrics and --metrics
+		if (vm.count("serve") || vm.count("metrics"))
+			enable_metrics();
+		if (vm.count("metrics"))
+			dump_metrics_on_signal(metrics_file.string(), cache.get());
+
+		if (vm.count("serve"))
 		{
-			for (string line; safe_getline(cin, line);)
+			serve_api(opts, cache.get(), { serve, workers, version, where, builtin, vm.count("release") ? release : "", releases_dir, database_file, deltas });
+			return 0;
+		}
+
+		auto report = [&](int retcode)
+		{
+			if (cache_stats && cache)
+				cache->write_stats(cerr);
+			if (vm.count("metrics") && !dump_metrics(metrics_file.string(), cache.get()))
 			{
-				trim(line);
-				if (line.empty() || line[0] == '#')
-					continue;
-				int retcode = process(no_cols, last_col, no_headers, show_unmatched, scheme_id, line_no, line, hlcolor);
-				if (!ignore_errors && retcode)
-					return retcode;
+				cerr << "ERROR: cannot write metrics file '" << metrics_file.string() << "'" << endl;
+				return 2;
 			}
+			return retcode;
+		};
+
+		// binary records skip the text formatting, so only the lookup settings apply
+		if (vm.count("shm"))
+		{
+			serve_records(opts, shm, shm_channels);
+			return report(0);
 		}
-		return 0;
+
+		// the line editor draws on stdout, so a redirected stdout reads typed lines plainly like a pipe
+		query_input input{ queries, vm.count("file") ? file : path(), !is_redirected(stdin) && !is_redirected(stdout), plan, ignore_errors,
+			{ plan && vm["batch"].defaulted() ? plan_block : batch, chrono::microseconds(flush_latency) } };
+		return report(answer_queries(opts, cache.get(), input));
 	}
 	catch (exception& ex)
 	{
 		cerr << "ERROR: " << ex.what() << endl;
 		return 2;
 	}
-}
\ No newline at end of file
+}
+
+int main(int argc, char* argv[])
+{
+	report_startup();
+
+	// answers handed to a compressing or asynchronous writer may fail to be written after they were accepted
+	unique_ptr<output_backend> backend;
+	int retcode = run(argc, argv, backend);
+	if (backend && !backend->close() && !retcode)
+	{
+		cerr << "ERROR: cannot write the output" << endl;
+		retcode = 2;
+	}
+	return retcode;
+}
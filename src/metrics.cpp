@@ -0,0 +1,267 @@
+#ifndef _WIN32
+#include <csignal>
+#include <pthread.h>
+#endif
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "metrics.hpp"
+using namespace std;
+using namespace std::filesystem;
+
+bool metrics_enabled = false;
+
+static const array<const char*, 6> kind_names{ "seq", "label", "dump", "constraint", "transfer", "invalid" };
+
+// latencies in nanoseconds go into log-linear buckets as in HDR histograms: exact below 128 ns, then 64 buckets per
+// power of two, which keeps every value within 1.6% of its bucket, up to 2^37 ns or about two minutes
+static const size_t linear_buckets = 128, octave_buckets = 64, bucket_count = 2048;
+
+static int log2_floor(uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return 63 - __builtin_clzll(value);
+#else
+	int n = 0;
+	while (value >>= 1)
+		++n;
+	return n;
+#endif
+}
+
+static size_t bucket_of(uint64_t ns)
+{
+	if (ns < linear_buckets)
+		return (size_t)ns;
+	int e = log2_floor(ns);
+	auto bucket = linear_buckets + (e - 7) * octave_buckets + (size_t)((ns >> (e - 6)) - octave_buckets);
+	return min(bucket, bucket_count - 1);
+}
+
+// the highest value of a bucket, which is what a quantile falling into it reports
+static uint64_t bucket_limit(size_t bucket)
+{
+	if (bucket < linear_buckets)
+		return bucket;
+	int e = (int)((bucket - linear_buckets) / octave_buckets) + 7;
+	uint64_t mantissa = (bucket - linear_buckets) % octave_buckets + octave_buckets;
+	return ((mantissa + 1) << (e - 6)) - 1;
+}
+
+struct histogram
+{
+	array<atomic<uint64_t>, bucket_count> buckets;
+	atomic<uint64_t> sum_ns;
+};
+
+// the counts of one thread, written by it alone
+struct metrics_shard
+{
+	array<atomic<uint64_t>, kind_names.size()> queries, errors, rows;
+	array<histogram, kind_names.size()> latency;
+	histogram output;
+};
+
+// with a single writer an increment needs no read-modify-write instruction, only a store readers cannot see torn
+static void add(atomic<uint64_t>& counter, uint64_t n)
+{
+	counter.store(counter.load(memory_order_relaxed) + n, memory_order_relaxed);
+}
+
+static void record(histogram& h, chrono::steady_clock::duration elapsed)
+{
+	auto ns = (uint64_t)max<int64_t>(0, chrono::duration_cast<chrono::nanoseconds>(elapsed).count());
+	add(h.buckets[bucket_of(ns)], 1);
+	add(h.sum_ns, ns);
+}
+
+// shards outlive their threads, so that nothing counted is lost when a thread exits
+static mutex registering;
+static vector<unique_ptr<metrics_shard>> shards;
+
+static metrics_shard& local_shard()
+{
+	thread_local metrics_shard* shard = []
+	{
+		lock_guard<mutex> guard(registering);
+		shards.push_back(make_unique<metrics_shard>());
+		return shards.back().get();
+	}();
+	return *shard;
+}
+
+void enable_metrics()
+{
+	metrics_enabled = true;
+}
+
+query_kind classify_query(const string& query)
+{
+	auto colon = query.find(':');
+	if (colon == string::npos)
+		return query_kind::invalid;
+	return classify_numbering(query.substr(colon + 1), SIZE_MAX);
+}
+
+void count_query(const string& query, int rows)
+{
+	if (!metrics_enabled)
+		return;
+	auto& shard = local_shard();
+	auto k = (size_t)classify_query(query);
+	add(shard.queries[k], 1);
+	add(shard.rows[k], rows);
+}
+
+query_timer::~query_timer()
+{
+	if (!enabled)
+		return;
+	auto end = chrono::steady_clock::now();
+	auto& shard = local_shard();
+	auto k = (size_t)kind;
+	add(shard.queries[k], 1);
+	if (rows < 0)
+	{
+		add(shard.errors[k], 1);
+	}
+	else
+	{
+		add(shard.rows[k], rows);
+		record(shard.output, end - output);
+	}
+	record(shard.latency[k], end - start);
+}
+
+// the sum of a histogram over the shards
+struct merged_histogram
+{
+	vector<uint64_t> buckets = vector<uint64_t>(bucket_count);
+	uint64_t count = 0, sum_ns = 0;
+
+	void add(const histogram& h)
+	{
+		for (size_t i = 0; i < bucket_count; i++)
+		{
+			auto n = h.buckets[i].load(memory_order_relaxed);
+			buckets[i] += n;
+			count += n;
+		}
+		sum_ns += h.sum_ns.load(memory_order_relaxed);
+	}
+
+	double quantile(double q) const
+	{
+		auto rank = max<uint64_t>(1, (uint64_t)ceil(q * count));
+		uint64_t seen = 0;
+		for (size_t i = 0; i < bucket_count; i++)
+			if ((seen += buckets[i]) >= rank)
+				return bucket_limit(i) / 1e9;
+		return 0;
+	}
+};
+
+static void write_summary(ostream& out, const string& name, const string& labels, const merged_histogram& h)
+{
+	for (auto q : { "0.5", "0.99", "0.999" })
+		out << name << '{' << labels << (labels.size() ? "," : "") << "quantile=\"" << q << "\"} " << h.quantile(stod(q)) << '\n';
+	auto suffix = labels.size() ? '{' + labels + '}' : string();
+	out << name << "_sum" << suffix << ' ' << h.sum_ns / 1e9 << '\n';
+	out << name << "_count" << suffix << ' ' << h.count << '\n';
+}
+
+void write_metrics(ostream& out, const result_cache* cache)
+{
+	array<uint64_t, kind_names.size()> queries{}, errors{}, rows{};
+	vector<merged_histogram> latency(kind_names.size());
+	merged_histogram output;
+	{
+		lock_guard<mutex> guard(registering);
+		for (auto& shard : shards)
+		{
+			for (size_t k = 0; k < kind_names.size(); k++)
+			{
+				queries[k] += shard->queries[k].load(memory_order_relaxed);
+				errors[k] += shard->errors[k].load(memory_order_relaxed);
+				rows[k] += shard->rows[k].load(memory_order_relaxed);
+				latency[k].add(shard->latency[k]);
+			}
+			output.add(shard->output);
+		}
+	}
+
+	auto counter = [&](const string& name, const string& help, const array<uint64_t, kind_names.size()>& values)
+	{
+		out << "# HELP " << name << ' ' << help << "\n# TYPE " << name << " counter\n";
+		for (size_t k = 0; k < kind_names.size(); k++)
+			out << name << "{kind=\"" << kind_names[k] << "\"} " << values[k] << '\n';
+	};
+	counter("gpcrn_queries_total", "Queries answered, by the form of their numbering.", queries);
+	counter("gpcrn_query_errors_total", "Queries answered with an error.", errors);
+	counter("gpcrn_rows_total", "Rows in the answers.", rows);
+
+	if (cache)
+	{
+		out << "# HELP gpcrn_cache_hits_total Queries answered from the result cache.\n# TYPE gpcrn_cache_hits_total counter\n"
+			<< "gpcrn_cache_hits_total " << cache->hits() << '\n'
+			<< "# HELP gpcrn_cache_misses_total Queries evaluated for want of a cached result.\n# TYPE gpcrn_cache_misses_total counter\n"
+			<< "gpcrn_cache_misses_total " << cache->misses() << '\n'
+			<< "# HELP gpcrn_cache_entries Results in the cache.\n# TYPE gpcrn_cache_entries gauge\n"
+			<< "gpcrn_cache_entries " << cache->size() << '\n'
+			<< "# HELP gpcrn_cache_bytes Bytes of keys and results in the cache.\n# TYPE gpcrn_cache_bytes gauge\n"
+			<< "gpcrn_cache_bytes " << cache->bytes() << '\n';
+	}
+
+	out << "# HELP gpcrn_query_duration_seconds Latency of a query from its arrival to the end of its output; queries planned in blocks are not timed.\n"
+		<< "# TYPE gpcrn_query_duration_seconds summary\n";
+	for (size_t k = 0; k < kind_names.size(); k++)
+		write_summary(out, "gpcrn_query_duration_seconds", string("kind=\"") + kind_names[k] + '"', latency[k]);
+
+	out << "# HELP gpcrn_output_duration_seconds Time spent writing out an answer.\n# TYPE gpcrn_output_duration_seconds summary\n";
+	write_summary(out, "gpcrn_output_duration_seconds", "", output);
+}
+
+bool dump_metrics(const string& file, const result_cache* cache)
+{
+	auto temporary = file + ".tmp";
+	{
+		ofstream out(temporary);
+		if (!out)
+			return false;
+		write_metrics(out, cache);
+		if (!out.flush())
+			return false;
+	}
+	error_code ec;
+	rename(temporary, file, ec);
+	return !ec;
+}
+
+void dump_metrics_on_signal(const string& file, const result_cache* cache)
+{
+#ifndef _WIN32
+	sigset_t usr1;
+	sigemptyset(&usr1);
+	sigaddset(&usr1, SIGUSR1);
+	pthread_sigmask(SIG_BLOCK, &usr1, nullptr);
+	thread([file, cache, usr1]
+	{
+		// this thread takes no other signal
+		sigset_t all;
+		sigfillset(&all);
+		pthread_sigmask(SIG_BLOCK, &all, nullptr);
+		for (int signal; sigwait(&usr1, &signal) == 0;)
+			if (!dump_metrics(file, cache))
+				cerr << "ERROR: cannot write metrics file '" << file << "'" << endl;
+	}).detach();
+#endif
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <chrono>
+#include <ostream>
+#include <string>
+#include "cache.hpp"
+#include "lookup.hpp"
+using namespace std;
+
+// Counters and latency histograms of the queries answered by a resident gpcrn. Every thread records into a shard of
+// its own with plain relaxed stores, so recording takes no lock and shares no cache line; a scrape sums the shards.
+
+//! Whether the queries are being counted, set by enable_metrics() before any of them is answered.
+extern bool metrics_enabled;
+
+//! Starts counting; until then the timers cost one branch.
+void enable_metrics();
+
+//! The kind of a query by its numbering, or query_kind::invalid if it has no colon; labels of any width count as labels.
+query_kind classify_query(const string& query);
+
+//! Counts a query answered in a block by --plan, which has rows and no latency of its own.
+void count_query(const string& query, int rows);
+
+//! Times a query from its construction to its destruction and counts it with its kind, rows and outcome.
+//! A query whose answer is never reported by answered() is counted as an error.
+class query_timer
+{
+public:
+	explicit query_timer(const string& query) : enabled(metrics_enabled)
+	{
+		if (enabled)
+		{
+			kind = classify_query(query);
+			start = chrono::steady_clock::now();
+		}
+	}
+	explicit query_timer(query_kind kind) : enabled(metrics_enabled), kind(kind)
+	{
+		if (enabled)
+			start = chrono::steady_clock::now();
+	}
+	~query_timer();
+	query_timer(const query_timer&) = delete;
+	query_timer& operator=(const query_timer&) = delete;
+
+	//! Reports the number of rows of the answer and starts the output stage, which lasts until the destruction.
+	void answered(int rows)
+	{
+		if (enabled)
+		{
+			this->rows = rows;
+			output = chrono::steady_clock::now();
+		}
+	}
+
+private:
+	bool enabled;
+	query_kind kind = query_kind::invalid;
+	int rows = -1;
+	chrono::steady_clock::time_point start, output;
+};
+
+//! Writes the metrics in the Prometheus text exposition format, with the counts of the result cache if any.
+void write_metrics(ostream& out, const result_cache* cache);
+
+//! Rewrites file with the metrics on every SIGUSR1 from now on, replacing it in one rename. It must be called before
+//! any other thread is started, so that they all inherit the blocked signal. Does nothing on Windows.
+void dump_metrics_on_signal(const string& file, const result_cache* cache);
+
+//! Writes the metrics into file, replacing it in one rename; returns false if it cannot be written.
+bool dump_metrics(const string& file, const result_cache* cache);
@@ -0,0 +1,200 @@
+#include <algorithm>
+#include <cctype>
+#include <queue>
+#include <unordered_map>
+#include "database.hpp"
+#include "filter.hpp"
+#include "msa.hpp"
+#include "numbering.hpp"
+#include "string.hpp"
+using namespace std;
+
+const set<string> msa_formats
+{
+	"fasta",
+	"stockholm",
+	"a3m",
+};
+
+// the columns of a scheme: the column of every string_table row, -1 if unlabeled, and the labels in column order
+struct msa_columns
+{
+	vector<int> row_column;
+	vector<string> labels;
+};
+
+static msa_columns order_columns(int scheme_id)
+{
+	auto& t = tables();
+	auto [offset, width, names] = t.schemes[scheme_id];
+
+	// rows sharing a label share a column
+	msa_columns cols;
+	unordered_map<string, int> label_column;
+	vector<string> labels;
+	cols.row_column.assign(t.string_table.size(), -1);
+	for (size_t r = 0; r < t.string_table.size(); r++)
+	{
+		auto label = trim(t.string_table[r].substr(offset, width));
+		if (label.empty())
+			continue;
+		auto [it, added] = label_column.emplace(label, (int)labels.size());
+		if (added)
+			labels.push_back(label);
+		cols.row_column[r] = it->second;
+	}
+
+	// every receptor orders the labels it carries along its sequence; the columns follow all of them where they agree
+	vector<vector<int>> successors(labels.size());
+	vector<int> indegree(labels.size());
+	for (auto& [uid, numbering] : t.numbering_data)
+	{
+		int last = -1;
+		for_each_residue(numbering, [&](int, int index, char)
+		{
+			int column = cols.row_column[index];
+			if (column < 0 || column == last)
+				return;
+			if (last >= 0)
+			{
+				successors[last].push_back(column);
+				++indegree[column];
+			}
+			last = column;
+		});
+	}
+
+	// a topological sort taking the smallest label first among the ready ones, and among all left on a cycle
+	auto greater = [&](int a, int b) { return natural_less(labels[b], labels[a]); };
+	priority_queue<int, vector<int>, decltype(greater)> ready(greater);
+	for (size_t c = 0; c < labels.size(); c++)
+		if (!indegree[c])
+			ready.push((int)c);
+
+	vector<int> order;
+	vector<bool> placed(labels.size());
+	while (order.size() < labels.size())
+	{
+		if (ready.empty())
+		{
+			int next = -1;
+			for (size_t c = 0; c < labels.size(); c++)
+				if (!placed[c] && (next < 0 || natural_less(labels[c], labels[next])))
+					next = (int)c;
+			indegree[next] = 0;
+			ready.push(next);
+		}
+		int c = ready.top();
+		ready.pop();
+		if (placed[c])
+			continue;
+		placed[c] = true;
+		order.push_back(c);
+		for (auto s : successors[c])
+			if (!placed[s] && --indegree[s] == 0)
+				ready.push(s);
+	}
+
+	vector<int> position(labels.size());
+	for (size_t i = 0; i < order.size(); i++)
+	{
+		position[order[i]] = (int)i;
+		cols.labels.push_back(labels[order[i]]);
+	}
+	for (auto& c : cols.row_column)
+		if (c >= 0)
+			c = position[c];
+	return cols;
+}
+
+void write_msa(ostream& out, const string& format, int scheme_id, const vector<int>& receptors)
+{
+	auto& t = tables();
+	static array<table_cache<msa_columns>, scheme_count> columns;
+	auto& cols = columns[scheme_id].get([scheme_id] { return order_columns(scheme_id); });
+
+	// the receptor-by-column matrix, filled in one pass over the residues; a residue out of column order, or not in any,
+	// is left out, and a3m keeps it as an insertion after the last column filled before it
+	bool a3m = format == "a3m";
+	auto& ids = receptor_ids();
+	size_t width = cols.labels.size();
+	vector<char> matrix(receptors.size() * width, '-');
+	vector<vector<string>> insertions(a3m ? receptors.size() : 0);
+	vector<bool> used(width);
+	for (size_t i = 0; i < receptors.size(); i++)
+	{
+		auto it = t.numbering_data.find(ids[receptors[i]]);
+		if (it == t.numbering_data.end())
+			continue;
+		auto& residues = get<2>(it->second);
+		auto indices = decode_runs(it->second);
+		auto row = matrix.begin() + i * width;
+		if (a3m)
+			insertions[i].resize(width + 1);
+
+		int last = -1;
+		for (size_t k = 0; k < indices.size(); k++)
+		{
+			// '.' stands for residues missing from the numbering data
+			if (!isalpha((unsigned char)residues[k]))
+				continue;
+			int column = indices[k] < 0 ? -1 : cols.row_column[indices[k]];
+			if (column > last)
+			{
+				row[column] = (char)toupper((unsigned char)residues[k]);
+				used[column] = true;
+				last = column;
+			}
+			else if (a3m)
+			{
+				insertions[i][last + 1] += (char)tolower((unsigned char)residues[k]);
+			}
+		}
+	}
+
+	auto name_width = 0;
+	for (auto r : receptors)
+		name_width = max(name_width, (int)ids[r].size());
+
+	if (format == "stockholm")
+	{
+		out << "# STOCKHOLM 1.0\n";
+		out << "#=GF ID gpcrn_" << get<2>(t.schemes[scheme_id])[1] << '\n';
+		out << "#=GF DE Alignment by " << get<2>(t.schemes[scheme_id])[0] << " numbering, GPCRdb " << t.version << '\n';
+		for (auto r : receptors)
+		{
+			auto& [symbol, species, gene_name, long_species] = t.uniprot_dict.at(ids[r]);
+			out << "#=GS " << ids[r] << string(name_width - ids[r].size(), ' ') << " DE " << symbol << '_' << species << ' ' << gene_name << '\n';
+		}
+	}
+
+	string line;
+	for (size_t i = 0; i < receptors.size(); i++)
+	{
+		auto& uid = ids[receptors[i]];
+		auto row = matrix.begin() + i * width;
+		line.clear();
+		if (a3m && insertions[i].size())
+			line += insertions[i][0];
+		for (size_t c = 0; c < width; c++)
+		{
+			if (used[c])
+				line += row[c];
+			if (a3m && insertions[i].size())
+				line += insertions[i][c + 1];
+		}
+
+		if (format == "stockholm")
+		{
+			out << uid << string(name_width - uid.size() + 1, ' ') << line << '\n';
+		}
+		else
+		{
+			auto& [symbol, species, gene_name, long_species] = t.uniprot_dict.at(uid);
+			out << '>' << uid << ' ' << symbol << '_' << species << ' ' << gene_name << '\n' << line << '\n';
+		}
+	}
+
+	if (format == "stockholm")
+		out << "//\n";
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include <ostream>
+#include <string>
+#include <set>
+#include <vector>
+using namespace std;
+
+//! The output formats of the alignment.
+extern const set<string> msa_formats;
+
+//! Writes the alignment of the given receptor ordinals implied by a scheme's labels, in fasta, stockholm or a3m.
+//! Every label is a column and every receptor a row holding the first residue carrying that label, or a gap.
+//! Columns follow the order the labels take along the sequences, ties broken by the numbers within the labels,
+//! and columns without a residue in any of the receptors are left out. a3m adds the other residues as lowercase insertions.
+void write_msa(ostream& out, const string& format, int scheme_id, const vector<int>& receptors);
@@ -0,0 +1,282 @@
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+#include "npy.hpp"
+#include "database.hpp"
+#include "numbering.hpp"
+using namespace std;
+
+// the bytes of an input file, mapped where possible and read otherwise
+class mapped_file
+{
+public:
+	explicit mapped_file(const path& file)
+	{
+#ifndef _WIN32
+		int fd = open(file.c_str(), O_RDONLY);
+		struct stat st;
+		if (fd >= 0 && fstat(fd, &st) == 0)
+		{
+			length = st.st_size;
+			if (length)
+			{
+				void* p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+				if (p != MAP_FAILED)
+				{
+					madvise(p, length, MADV_SEQUENTIAL);
+					bytes = (const char*)p;
+					mapped = true;
+				}
+			}
+			close(fd);
+			if (mapped || !length)
+				return;
+		}
+		else if (fd >= 0)
+		{
+			close(fd);
+		}
+#endif
+		ifstream in(file, ios::binary);
+		if (!in)
+			throw runtime_error("cannot open '" + file.string() + "'");
+		buffer.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+		bytes = buffer.data();
+		length = buffer.size();
+	}
+
+	~mapped_file()
+	{
+#ifndef _WIN32
+		if (mapped)
+			munmap((void*)bytes, length);
+#endif
+	}
+
+	mapped_file(const mapped_file&) = delete;
+	mapped_file& operator=(const mapped_file&) = delete;
+
+	const char* data() const { return bytes; }
+	size_t size() const { return length; }
+
+private:
+	const char* bytes = nullptr;
+	size_t length = 0;
+	bool mapped = false;
+	vector<char> buffer;
+};
+
+// the header dictionary of a .npy file: {'descr': '<i8', 'fortran_order': False, 'shape': (3, 4), }
+struct npy_header
+{
+	string descr;
+	bool fortran_order = false;
+	string shape;       // as written, e.g. "(3, 4)"
+	size_t count = 1;   // the number of elements
+	size_t data_offset = 0;
+};
+
+static string dict_value(const string& dict, const string& key, const path& file)
+{
+	auto pos = dict.find("'" + key + "'");
+	if (pos == string::npos || (pos = dict.find(':', pos)) == string::npos)
+		throw runtime_error("invalid .npy header in '" + file.string() + "'; no " + key);
+	pos = dict.find_first_not_of(' ', pos + 1);
+	if (pos == string::npos)
+		throw runtime_error("invalid .npy header in '" + file.string() + "'");
+	size_t end;
+	if (dict[pos] == '\'')
+		end = dict.find('\'', pos + 1) + 1;
+	else if (dict[pos] == '(')
+		end = dict.find(')', pos) + 1;
+	else
+		end = dict.find_first_of(",}", pos);
+	if (end == string::npos || end == 0)
+		throw runtime_error("invalid .npy header in '" + file.string() + "'");
+	return dict.substr(pos, end - pos);
+}
+
+static npy_header parse_header(const mapped_file& in, const path& file)
+{
+	auto p = in.data();
+	if (in.size() < 10 || memcmp(p, "\x93NUMPY", 6))
+		throw runtime_error("'" + file.string() + "' is not a .npy file");
+
+	npy_header h;
+	size_t length;
+	if (p[6] == 1)
+	{
+		length = (unsigned char)p[8] | (unsigned char)p[9] << 8;
+		h.data_offset = 10 + length;
+	}
+	else if (in.size() >= 12)
+	{
+		length = (unsigned char)p[8] | (unsigned char)p[9] << 8 | (size_t)(unsigned char)p[10] << 16 | (size_t)(unsigned char)p[11] << 24;
+		h.data_offset = 12 + length;
+	}
+	else
+	{
+		throw runtime_error("invalid .npy header in '" + file.string() + "'");
+	}
+	if (h.data_offset > in.size())
+		throw runtime_error("truncated .npy file '" + file.string() + "'");
+
+	string dict(p + h.data_offset - length, length);
+	auto descr = dict_value(dict, "descr", file);
+	h.descr = descr.size() >= 2 && descr.front() == '\'' ? descr.substr(1, descr.size() - 2) : descr;
+	h.fortran_order = dict_value(dict, "fortran_order", file) == "True";
+	h.shape = dict_value(dict, "shape", file);
+
+	// a tuple of dimensions, where only the last may be empty as in (3,)
+	if (h.shape.size() < 2 || h.shape.front() != '(' || h.shape.back() != ')')
+		throw runtime_error("invalid .npy header in '" + file.string() + "'; shape " + h.shape);
+	for (size_t i = 1; i < h.shape.size();)
+	{
+		auto end = h.shape.find_first_of(",)", i);
+		auto dim = h.shape.substr(i, end - i);
+		dim.erase(remove(dim.begin(), dim.end(), ' '), dim.end());
+		if (dim.empty() ? h.shape[end] != ')' : dim.size() > 18 || !all_of(dim.begin(), dim.end(), ::isdigit))
+			throw runtime_error("invalid .npy header in '" + file.string() + "'; shape " + h.shape);
+		if (dim.size())
+		{
+			auto n = stoull(dim);
+			if (n && h.count > SIZE_MAX / n)
+				throw runtime_error("invalid .npy header in '" + file.string() + "'; shape " + h.shape);
+			h.count *= n;
+		}
+		i = end + 1;
+	}
+	return h;
+}
+
+static void write_header(ofstream& out, const string& descr, const npy_header& in)
+{
+	string dict = "{'descr': '" + descr + "', 'fortran_order': " + (in.fortran_order ? "True" : "False") + ", 'shape': " + in.shape + ", }";
+
+	// the data starts at a multiple of 64 bytes, the header ending with a newline
+	size_t total = 10 + dict.size() + 1;
+	dict.append((64 - total % 64) % 64, ' ');
+	dict += '\n';
+	char preamble[10] = { '\x93', 'N', 'U', 'M', 'P', 'Y', 1, 0, (char)(dict.size() & 0xff), (char)(dict.size() >> 8) };
+	out.write(preamble, sizeof(preamble));
+	out.write(dict.data(), dict.size());
+}
+
+// maps every element through a table of string_table indices by sequence number, one chunk of output at a time
+template<class T>
+static size_t annotate(const char* data, size_t count, const vector<short>& indices, int low, const function<void(const short*, size_t)>& flush)
+{
+	constexpr size_t chunk = 1 << 16;
+	short out[chunk];
+	size_t numbered = 0;
+	for (size_t begin = 0; begin < count; begin += chunk)
+	{
+		size_t n = min(chunk, count - begin);
+		for (size_t i = 0; i < n; i++)
+		{
+			T seq;
+			memcpy(&seq, data + (begin + i) * sizeof(T), sizeof(T));
+			long long k = (long long)seq - low;
+			out[i] = k >= 0 && k < (long long)indices.size() ? indices[k] : -1;
+			numbered += out[i] >= 0;
+		}
+		flush(out, n);
+	}
+	return numbered;
+}
+
+size_t annotate_npy(const path& input, const path& output, const string& uniprot, int scheme_id, npy_emit emit)
+{
+	auto& t = tables();
+	mapped_file in(input);
+	auto header = parse_header(in, input);
+
+	// sequence numbers are integers in little-endian or single bytes
+	auto& d = header.descr;
+	if (d.size() != 3 || (d[0] != '<' && d[0] != '|' && d[0] != '=') || (d[1] != 'i' && d[1] != 'u') || !strchr("1248", d[2]))
+		throw runtime_error("unsupported dtype '" + d + "' in '" + input.string() + "'; use a little-endian integer type");
+	size_t item = d[2] - '0';
+	if (header.data_offset + header.count * item > in.size())
+		throw runtime_error("truncated .npy file '" + input.string() + "'");
+
+	// the string_table index of every residue from the lowest sequence number on, -1 where unnumbered
+	vector<short> indices;
+	int low = 0;
+	if (auto it = t.numbering_data.find(uniprot); it != t.numbering_data.end())
+	{
+		indices = decode_runs(it->second);
+		low = get<0>(it->second);
+	}
+
+	ofstream out(output, ios::binary);
+	if (!out)
+		throw runtime_error("cannot write '" + output.string() + "'");
+
+	// labels are fixed-width bytes, NUL-padded as numpy pads its S dtype
+	auto [offset, width, names] = t.schemes[scheme_id];
+	vector<char> labels;
+	if (emit == npy_emit::label)
+	{
+		labels.assign((t.string_table.size() + 1) * width, 0);
+		for (size_t r = 0; r < t.string_table.size(); r++)
+		{
+			auto label = t.string_table[r].substr(offset, width);
+			label.erase(label.find_last_not_of(' ') + 1);
+			memcpy(&labels[(r + 1) * width], label.data(), label.size());
+		}
+		write_header(out, "|S" + to_string(width), header);
+	}
+	else
+	{
+		write_header(out, "<i2", header);
+	}
+
+	vector<char> bytes;
+	function<void(const short*, size_t)> flush = [&](const short* index, size_t n)
+	{
+		if (emit == npy_emit::index)
+		{
+			// little-endian, as the header says
+			bytes.resize(n * 2);
+			for (size_t i = 0; i < n; i++)
+			{
+				bytes[2 * i] = (char)(index[i] & 0xff);
+				bytes[2 * i + 1] = (char)((unsigned short)index[i] >> 8);
+			}
+		}
+		else
+		{
+			bytes.resize(n * width);
+			for (size_t i = 0; i < n; i++)
+				memcpy(&bytes[i * width], &labels[(index[i] + 1) * width], width);
+		}
+		out.write(bytes.data(), bytes.size());
+	};
+
+	auto data = in.data() + header.data_offset;
+	size_t numbered = 0;
+	switch (d[1] == 'i' ? (int)item : -(int)item)
+	{
+	case 1: numbered = annotate<int8_t>(data, header.count, indices, low, flush); break;
+	case 2: numbered = annotate<int16_t>(data, header.count, indices, low, flush); break;
+	case 4: numbered = annotate<int32_t>(data, header.count, indices, low, flush); break;
+	case 8: numbered = annotate<int64_t>(data, header.count, indices, low, flush); break;
+	case -1: numbered = annotate<uint8_t>(data, header.count, indices, low, flush); break;
+	case -2: numbered = annotate<uint16_t>(data, header.count, indices, low, flush); break;
+	case -4: numbered = annotate<uint32_t>(data, header.count, indices, low, flush); break;
+	case -8: numbered = annotate<uint64_t>(data, header.count, indices, low, flush); break;
+	}
+	if (!out.flush())
+		throw runtime_error("cannot write '" + output.string() + "'");
+	return numbered;
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include <filesystem>
+#include <string>
+using namespace std;
+using namespace std::filesystem;
+
+//! What annotate_npy() writes for every sequence number.
+enum class npy_emit
+{
+	index, // the string_table index as int16, -1 if the residue is unnumbered
+	label, // the label in the scheme as fixed-width bytes, empty if the residue is unnumbered or unlabeled
+};
+
+//! Reads a .npy array of integer residue sequence numbers of one receptor, memory-mapped where the system allows it,
+//! and writes a .npy array of the same shape and order holding their string_table indices or labels in a scheme.
+//! Returns the number of numbered elements. Throws runtime_error on unreadable files or unsupported dtypes.
+size_t annotate_npy(const path& input, const path& output, const string& uniprot, int scheme_id, npy_emit emit);
@@ -0,0 +1,48 @@
+#include <algorithm>
+#include "numbering.hpp"
+using namespace std;
+
+bool find_residue(const receptor_numbering& numbering, int seq, int& index, char& res_name)
+{
+	auto& [low, length, residues, runs] = numbering;
+	int k = seq - low;
+	if (k < 0 || k >= length)
+		return false;
+
+	// the last run starting at or before k
+	auto it = upper_bound(runs.begin(), runs.end(), k, [](int k, auto& run) { return k < run[0]; });
+	if (it == runs.begin())
+		return false;
+	auto& [offset, count, first] = *--it;
+	if (k >= offset + count)
+		return false;
+
+	index = first + k - offset;
+	res_name = residues[k];
+	return true;
+}
+
+vector<short> decode_runs(const receptor_numbering& numbering)
+{
+	auto& [low, length, residues, runs] = numbering;
+	vector<short> indices(length, -1);
+	for (auto& [offset, count, first] : runs)
+		for (int i = 0; i < count; i++)
+			indices[offset + i] = (short)(first + i);
+	return indices;
+}
+
+vector<array<short, 3>> encode_runs(const vector<short>& indices)
+{
+	vector<array<short, 3>> runs;
+	for (size_t i = 0; i < indices.size(); i++)
+	{
+		if (indices[i] == -1)
+			continue;
+		if (runs.size() && runs.back()[0] + runs.back()[1] == (int)i && runs.back()[2] + runs.back()[1] == indices[i])
+			++runs.back()[1];
+		else
+			runs.push_back({ (short)i, 1, indices[i] });
+	}
+	return runs;
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <array>
+#include <string>
+#include <vector>
+#include "database.hpp"
+using namespace std;
+
+//! A receptor's entry in numbering_data: low, length, residues and runs.
+//! A run [offset, count, first_index] numbers the count residues from low + offset on with consecutive string_table indices.
+using receptor_numbering = decltype(database_tables::numbering_data)::mapped_type;
+
+//! Finds the string_table index and residue name at a sequence number by a binary search over the runs; returns false if it is unnumbered.
+bool find_residue(const receptor_numbering& numbering, int seq, int& index, char& res_name);
+
+//! Expands the runs into one string_table index per residue, -1 for unnumbered ones.
+vector<short> decode_runs(const receptor_numbering& numbering);
+
+//! Compresses one string_table index per residue, -1 for unnumbered ones, into runs.
+vector<array<short, 3>> encode_runs(const vector<short>& indices);
+
+//! Calls f(seq, index, res_name) for every numbered residue in sequence order.
+template<class F>
+void for_each_residue(const receptor_numbering& numbering, F f)
+{
+	auto& [low, length, residues, runs] = numbering;
+	for (auto& [offset, count, first] : runs)
+		for (int i = 0; i < count; i++)
+			f(low + offset + i, first + i, residues[offset + i]);
+}
@@ -0,0 +1,374 @@
+#ifdef _WIN32
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <unistd.h>
+#endif
+#include <fcntl.h>
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define GPCRN_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include "output.hpp"
+#include "compress.hpp"
+using namespace std;
+
+static const size_t buffer_size = 1 << 20;
+
+// writes all of a buffer, retrying interrupted and partial writes
+static bool write_all(int fd, const char* data, size_t size)
+{
+	while (size)
+	{
+#ifdef _WIN32
+		auto n = _write(fd, data, (unsigned)min<size_t>(size, 1 << 30));
+#else
+		auto n = ::write(fd, data, size);
+#endif
+		if (n < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			return false;
+		}
+		data += n;
+		size -= n;
+	}
+	return true;
+}
+
+#ifdef GPCRN_IO_URING
+
+// A minimal io_uring with one write in flight at a time, which keeps the output in order on pipes and terminals
+// where writes at the current file position may otherwise complete out of order.
+class uring_writer
+{
+public:
+	~uring_writer()
+	{
+		if (ring_fd < 0)
+			return;
+		munmap(sqes, sqes_size);
+		if (cq_ptr != sq_ptr)
+			munmap(cq_ptr, cq_size);
+		munmap(sq_ptr, sq_size);
+		close(ring_fd);
+	}
+
+	// false if the kernel has no io_uring or it cannot write at the current file position (before Linux 5.6)
+	bool open(int target)
+	{
+		io_uring_params p{};
+		int r = (int)syscall(__NR_io_uring_setup, 2, &p);
+		if (r < 0)
+			return false;
+		ring_fd = r;
+		fd = target;
+		if (!(p.features & IORING_FEAT_RW_CUR_POS))
+			return false;
+
+		sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+		cq_size = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+		if (p.features & IORING_FEAT_SINGLE_MMAP)
+			sq_size = cq_size = max(sq_size, cq_size);
+		sq_ptr = mmap(nullptr, sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQ_RING);
+		if (sq_ptr == MAP_FAILED)
+			return false;
+		cq_ptr = sq_ptr;
+		if (!(p.features & IORING_FEAT_SINGLE_MMAP))
+		{
+			cq_ptr = mmap(nullptr, cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_CQ_RING);
+			if (cq_ptr == MAP_FAILED)
+				return false;
+		}
+		sqes_size = p.sq_entries * sizeof(io_uring_sqe);
+		sqes = (io_uring_sqe*)mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES);
+		if (sqes == MAP_FAILED)
+			return false;
+
+		auto sq = (char*)sq_ptr, cq = (char*)cq_ptr;
+		sq_tail = (unsigned*)(sq + p.sq_off.tail);
+		sq_mask = (unsigned*)(sq + p.sq_off.ring_mask);
+		sq_array = (unsigned*)(sq + p.sq_off.array);
+		cq_head = (unsigned*)(cq + p.cq_off.head);
+		cq_tail = (unsigned*)(cq + p.cq_off.tail);
+		cq_mask = (unsigned*)(cq + p.cq_off.ring_mask);
+		cqes = (io_uring_cqe*)(cq + p.cq_off.cqes);
+		return true;
+	}
+
+	// queues a write of the buffer, which must stay untouched until wait() returns
+	bool submit(const char* data, size_t size)
+	{
+		pending = data;
+		pending_size = size;
+		return submit_pending();
+	}
+
+	// waits for the write in flight, resubmitting what a partial write left over
+	bool wait()
+	{
+		while (pending_size)
+		{
+			unsigned head = *cq_head;
+			while (head == __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE))
+			{
+				if (syscall(__NR_io_uring_enter, ring_fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0 && errno != EINTR)
+					return fail();
+			}
+			int res = cqes[head & *cq_mask].res;
+			__atomic_store_n(cq_head, head + 1, __ATOMIC_RELEASE);
+
+			if (res == -EINTR || res == -EAGAIN)
+				res = 0;
+			else if (res < 0)
+				return fail();
+			pending += res;
+			pending_size -= res;
+			if (pending_size && !submit_pending())
+				return false;
+		}
+		return true;
+	}
+
+private:
+	bool submit_pending()
+	{
+		unsigned tail = *sq_tail, index = tail & *sq_mask;
+		auto& sqe = sqes[index];
+		sqe = {};
+		sqe.opcode = IORING_OP_WRITE;
+		sqe.fd = fd;
+		sqe.off = (__u64)-1;
+		sqe.addr = (__u64)(uintptr_t)pending;
+		sqe.len = (__u32)min<size_t>(pending_size, 1u << 30);
+		sq_array[index] = index;
+		__atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+		while (syscall(__NR_io_uring_enter, ring_fd, 1, 0, 0, nullptr, 0) < 0)
+			if (errno != EINTR)
+				return fail();
+		return true;
+	}
+
+	bool fail()
+	{
+		pending_size = 0;
+		return false;
+	}
+
+	int ring_fd = -1, fd = -1;
+	void* sq_ptr = nullptr;
+	void* cq_ptr = nullptr;
+	size_t sq_size = 0, cq_size = 0, sqes_size = 0;
+	io_uring_sqe* sqes = nullptr;
+	unsigned *sq_tail, *sq_mask, *sq_array, *cq_head, *cq_tail, *cq_mask;
+	io_uring_cqe* cqes;
+	const char* pending = nullptr;
+	size_t pending_size = 0;
+};
+
+#endif
+
+// Formats into one buffer while the other is being written by io_uring, or writes each full buffer with write(2).
+class fd_buffer : public streambuf
+{
+public:
+	fd_buffer(int fd, bool owned, bool uring) : fd(fd), owned(owned)
+	{
+#ifdef GPCRN_IO_URING
+		if (uring && ring.open(fd))
+			async = true;
+#endif
+		for (auto& b : buffers)
+			b.resize(buffer_size);
+		setp(buffers[0].data(), buffers[0].data() + buffer_size);
+	}
+
+	~fd_buffer() override
+	{
+		sync();
+		if (owned)
+#ifdef _WIN32
+			_close(fd);
+#else
+			close(fd);
+#endif
+	}
+
+	bool asynchronous() const
+	{
+		return async;
+	}
+
+protected:
+	int_type overflow(int_type c) override
+	{
+		if (!hand_off())
+			return traits_type::eof();
+		if (!traits_type::eq_int_type(c, traits_type::eof()))
+		{
+			*pptr() = traits_type::to_char_type(c);
+			pbump(1);
+		}
+		return traits_type::not_eof(c);
+	}
+
+	int sync() override
+	{
+		return hand_off() && settle() ? 0 : -1;
+	}
+
+private:
+	// passes the filled part of the current buffer on and continues in the other one
+	bool hand_off()
+	{
+		auto size = (size_t)(pptr() - pbase());
+		if (failed)
+			return false;
+		if (!size)
+			return true;
+
+#ifdef GPCRN_IO_URING
+		if (async)
+			failed = !ring.wait() || !ring.submit(pbase(), size);
+		else
+#endif
+			failed = !write_all(fd, pbase(), size);
+
+		// the other buffer is free again once the write before this one has completed
+		current ^= 1;
+		setp(buffers[current].data(), buffers[current].data() + buffer_size);
+		return !failed;
+	}
+
+	// waits for the write in flight, so that everything handed off is written
+	bool settle()
+	{
+#ifdef GPCRN_IO_URING
+		if (async && !failed)
+			failed = !ring.wait();
+#endif
+		return !failed;
+	}
+
+	int fd;
+	bool owned;
+	array<vector<char>, 2> buffers;
+	int current = 0;
+	bool async = false;
+	bool failed = false;
+#ifdef GPCRN_IO_URING
+	uring_writer ring;
+#endif
+};
+
+spill_buffer::spill_buffer(size_t limit, streambuf* target, function<void()> spill) : limit(limit), target(target), spill(move(spill))
+{
+	setp(chunk.data(), chunk.data() + chunk.size());
+}
+
+streambuf::int_type spill_buffer::overflow(int_type c)
+{
+	pass_on();
+	if (!traits_type::eq_int_type(c, traits_type::eof()))
+	{
+		*pptr() = traits_type::to_char_type(c);
+		pbump(1);
+	}
+	return traits_type::not_eof(c);
+}
+
+string spill_buffer::finish()
+{
+	pass_on();
+	return move(kept);
+}
+
+// moves the chunk into the kept bytes, or on to the target once they are too many
+void spill_buffer::pass_on()
+{
+	auto size = (size_t)(pptr() - pbase());
+	if (!spilling && kept.size() + size > limit)
+	{
+		spilling = true;
+		spill();
+		target->sputn(kept.data(), kept.size());
+		kept = string();
+	}
+	if (spilling)
+		target->sputn(pbase(), size);
+	else
+		kept.append(pbase(), size);
+	setp(chunk.data(), chunk.data() + chunk.size());
+}
+
+output_backend::output_backend(const string& name, const path& file)
+{
+	if (file.empty() && name == "iostream")
+		return;
+
+	if (file.empty())
+	{
+		auto b = make_unique<fd_buffer>(1, false, name == "uring");
+		fell_back = name == "uring" && !b->asynchronous();
+		buffer = move(b);
+	}
+	else if (auto c = open_compressed_output(file))
+	{
+		compressed = c.get();
+		buffer = move(c);
+	}
+	else if (name == "iostream")
+	{
+		auto b = make_unique<filebuf>();
+		if (!b->open(file, ios::out | ios::binary | ios::trunc))
+			throw runtime_error("cannot write '" + file.string() + "'");
+		buffer = move(b);
+	}
+	else
+	{
+#ifdef _WIN32
+		int fd = _wopen(file.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+		int fd = ::open(file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+		if (fd < 0)
+			throw runtime_error("cannot write '" + file.string() + "'");
+		auto b = make_unique<fd_buffer>(fd, true, name == "uring");
+		fell_back = name == "uring" && !b->asynchronous();
+		buffer = move(b);
+	}
+
+	cout.flush();
+	original = cout.rdbuf(buffer.get());
+}
+
+output_backend::~output_backend()
+{
+	close();
+}
+
+bool output_backend::close()
+{
+	bool written = (bool)cout.flush();
+	if (!buffer)
+		return written;
+	cout.rdbuf(original);
+	if (compressed)
+		written = compressed->close() && written;
+	else if (auto f = dynamic_cast<filebuf*>(buffer.get()))
+		written = f->close() && written;
+	buffer.reset();
+	compressed = nullptr;
+	return written;
+}
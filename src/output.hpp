@@ -0,0 +1,64 @@
+#pragma once
+#include <array>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include "compress.hpp"
+using namespace std;
+using namespace std::filesystem;
+
+//! Points cout at one of the output backends for as long as it lives, then flushes it and restores the original buffer.
+//!   iostream: the standard cout buffer, left untouched
+//!   write:    1 MB buffers written to stdout with plain write(2) calls
+//!   uring:    two 1 MB buffers, one filled while the other is written asynchronously through Linux io_uring;
+//!             falls back to write where io_uring is unavailable, which fallback() then reports
+//! Given a file, cout writes into it rather than stdout; .gz and .zst files are compressed on a thread of their own instead.
+//! Throws runtime_error if the file cannot be written.
+class output_backend
+{
+public:
+	output_backend(const string& name, const path& file);
+	~output_backend();
+
+	//! Returns whether the uring backend was asked for but write is used instead.
+	bool fallback() const { return fell_back; }
+
+	//! Flushes and closes the output and restores the original cout buffer; returns false if any of it could not be written.
+	bool close();
+
+private:
+	unique_ptr<streambuf> buffer;
+	compressed_output* compressed = nullptr;
+	streambuf* original = nullptr;
+	bool fell_back = false;
+};
+
+//! Keeps what is written in memory up to limit bytes; once it outgrows them, calls spill() and hands the kept bytes and
+//! everything written after them on to target, a chunk at a time, so that a long output reaches the output backend while
+//! the rest of it is formatted instead of being held whole. Flushes do not reach target, only finish() does.
+class spill_buffer : public streambuf
+{
+public:
+	spill_buffer(size_t limit, streambuf* target, function<void()> spill);
+
+	//! Returns whether the output went on to target, in which case none of it is kept.
+	bool spilled() const { return spilling; }
+
+	//! Passes on the last chunk if the output spilled; returns the bytes kept otherwise.
+	string finish();
+
+protected:
+	int_type overflow(int_type c) override;
+
+private:
+	void pass_on();
+
+	size_t limit;
+	streambuf* target;
+	function<void()> spill;
+	bool spilling = false;
+	string kept;
+	array<char, 1 << 14> chunk;
+};
@@ -0,0 +1,199 @@
+#include <iostream>
+#include <memory>
+#include <exception>
+#include "pipeline.hpp"
+#include "ring.hpp"
+#include "string.hpp"
+using namespace std;
+
+// what one batch of lines wrote, as runs of stdout and stderr bytes in the order they were written
+struct batch_output
+{
+	vector<pair<bool, string>> chunks; // to stderr?, bytes
+};
+
+// an unbuffered stream buffer appending to the chunks of a batch
+class chunk_buffer : public streambuf
+{
+public:
+	chunk_buffer(batch_output& batch, bool to_err) : batch(batch), to_err(to_err)
+	{
+	}
+
+protected:
+	int_type overflow(int_type c) override
+	{
+		if (!traits_type::eq_int_type(c, traits_type::eof()))
+		{
+			char ch = traits_type::to_char_type(c);
+			xsputn(&ch, 1);
+		}
+		return traits_type::not_eof(c);
+	}
+
+	streamsize xsputn(const char* s, streamsize n) override
+	{
+		auto& chunks = batch.chunks;
+		if (chunks.empty() || chunks.back().first != to_err)
+			chunks.emplace_back(to_err, string());
+		chunks.back().second.append(s, n);
+		return n;
+	}
+
+private:
+	batch_output& batch;
+	bool to_err;
+};
+
+// shared with the reader, which may outlive run_pipeline() when it stops while the reader blocks on stdin
+struct pipeline_state
+{
+	spsc_ring<vector<string>> input{ 64 };
+	spsc_ring<batch_output> output{ 64 };
+	atomic<bool> stop{ false };
+	atomic<bool> reader_done{ false };
+	exception_ptr read_error; // set by the reader before it closes the input ring
+};
+
+static void read_batches(istream& in, size_t batch_size, shared_ptr<pipeline_state> s)
+{
+	vector<string> batch;
+	auto push = [&]
+	{
+		while (!s->input.try_push(batch))
+		{
+			if (s->stop)
+				return false;
+			s->input.wait_writable();
+		}
+		batch.clear();
+		return true;
+	};
+
+	try
+	{
+		for (string line; !s->stop && safe_getline(in, line);)
+		{
+			trim(line);
+			if (line.size() && line[0] != '#')
+				batch.push_back(move(line));
+
+			// the next line may take a while to come, so the ones at hand are answered first
+			if (batch.size() >= batch_size || (batch.size() && in.rdbuf()->in_avail() <= 0))
+				if (!push())
+					break;
+		}
+	}
+	catch (...)
+	{
+		s->read_error = current_exception();
+	}
+
+	// the lines read before an error are still answered
+	if (batch.size())
+		push();
+	s->input.close();
+	s->reader_done = true;
+}
+
+static void write_batches(streambuf* out, streambuf* err, chrono::microseconds flush_latency, shared_ptr<pipeline_state> s)
+{
+	bool unflushed = false;
+	chrono::steady_clock::time_point written;
+	for (batch_output batch;;)
+	{
+		if (s->output.try_pop(batch))
+		{
+			for (auto& [to_err, bytes] : batch.chunks)
+			{
+				if (to_err)
+				{
+					out->pubsync();
+					err->sputn(bytes.data(), bytes.size());
+					err->pubsync();
+				}
+				else
+				{
+					out->sputn(bytes.data(), bytes.size());
+				}
+			}
+			if (!unflushed)
+			{
+				unflushed = true;
+				written = chrono::steady_clock::now();
+			}
+			continue;
+		}
+
+		// answers are flushed once the lookups have caught up and the oldest of them has waited long enough
+		if (unflushed && chrono::steady_clock::now() - written >= flush_latency)
+		{
+			out->pubsync();
+			unflushed = false;
+		}
+		if (s->output.drained())
+			break;
+		if (unflushed)
+			s->output.wait_readable(written + flush_latency);
+		else
+			s->output.wait_readable();
+	}
+	out->pubsync();
+}
+
+int run_pipeline(istream& in, const pipeline_options& opts, const function<int(const vector<string>& lines)>& answer)
+{
+	auto s = make_shared<pipeline_state>();
+	auto out = cout.rdbuf(), err = cerr.rdbuf();
+	thread reader(read_batches, ref(in), max<size_t>(1, opts.batch_size), s);
+	thread writer(write_batches, out, err, opts.flush_latency, s);
+
+	int retcode = 0;
+	exception_ptr error;
+	for (vector<string> lines; !retcode && !error;)
+	{
+		if (!s->input.try_pop(lines))
+		{
+			if (s->input.drained())
+				break;
+			s->input.wait_readable();
+			continue;
+		}
+
+		// the standard streams point into the batch while it is answered
+		batch_output batch;
+		chunk_buffer batch_out(batch, false), batch_err(batch, true);
+		cout.rdbuf(&batch_out);
+		cerr.rdbuf(&batch_err);
+		try
+		{
+			retcode = answer(lines);
+		}
+		catch (...)
+		{
+			error = current_exception();
+		}
+		cout.rdbuf(out);
+		cerr.rdbuf(err);
+
+		while (!s->output.try_push(batch))
+			s->output.wait_writable();
+	}
+
+	s->stop = true;
+	s->input.abandon();
+	s->output.close();
+	writer.join();
+
+	// a reader still waiting for a terminal or a pipe is left to the process exit, any other stream ends soon enough
+	if (s->reader_done || &in != &cin)
+		reader.join();
+	else
+		reader.detach();
+
+	if (error)
+		rethrow_exception(error);
+	if (!retcode && s->reader_done && s->read_error)
+		rethrow_exception(s->read_error);
+	return retcode;
+}
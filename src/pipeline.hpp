@@ -0,0 +1,23 @@
+#pragma once
+#include <chrono>
+#include <functional>
+#include <istream>
+#include <string>
+#include <vector>
+using namespace std;
+
+//! Settings of the query stream pipeline.
+struct pipeline_options
+{
+	size_t batch_size = 256;                 // most lines handed to the lookups at once
+	chrono::microseconds flush_latency{ 0 }; // longest time written answers may wait for more before they are flushed
+};
+
+//! Answers a stream of queries on three stages connected by lock-free single-producer single-consumer rings:
+//! a reader thread cutting the input into batches of lines, the calling thread running answer() on each batch and
+//! a writer thread copying what answer() wrote to cout and cerr to the real streams in input order.
+//! A batch is handed on as soon as it is full or no more input is available without blocking, so a program waiting for
+//! each answer gets it at once; in must be buffered for that, e.g. cin after ios::sync_with_stdio(false).
+//! Blank lines and lines starting with # are skipped. Returns the first non-zero result of answer(), which stops the stream;
+//! exceptions thrown by answer() or by reading are rethrown once the stages have stopped.
+int run_pipeline(istream& in, const pipeline_options& opts, const function<int(const vector<string>& lines)>& answer);
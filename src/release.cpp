@@ -0,0 +1,163 @@
+#include <algorithm>
+#include <stdexcept>
+#include "numbering.hpp"
+#include "release.hpp"
+#include "string.hpp"
+using namespace std;
+
+// the release files of a directory by name, which is empty if dir is
+static vector<pair<string, path>> release_files(const path& dir)
+{
+	vector<pair<string, path>> files;
+	error_code ec;
+	if (dir.empty() || !is_directory(dir, ec))
+		return files;
+	for (auto& entry : directory_iterator(dir, ec))
+		if (entry.is_regular_file() && entry.path().extension() == ".db")
+			files.emplace_back(entry.path().stem().string(), entry.path());
+	sort(files.begin(), files.end());
+	return files;
+}
+
+vector<pair<string, string>> find_releases(const path& dir, const string& builtin_version)
+{
+	vector<pair<string, string>> releases{ { "builtin", builtin_version } };
+	for (auto& [name, file] : release_files(dir))
+	{
+		try
+		{
+			releases.emplace_back(name, read_database_version(file));
+		}
+		catch (exception&)
+		{
+			// not a database after all
+		}
+	}
+	return releases;
+}
+
+database_tables load_release(const path& dir, const string& name)
+{
+	if (name == "builtin")
+		return loaded_tables();
+
+	auto files = release_files(dir);
+	for (auto& [stem, file] : files)
+		if (stem == name)
+			return load_database(file);
+	for (auto& [stem, file] : files)
+	{
+		try
+		{
+			if (read_database_version(file) == name)
+				return load_database(file);
+		}
+		catch (exception&)
+		{
+		}
+	}
+	if (name == tables().version)
+		return loaded_tables();
+	throw runtime_error("unknown release '" + name + "'" + (dir.empty() ? "; set the releases directory with --releases or GPCRN_RELEASES" : "; see them with --list releases"));
+}
+
+// calls f(key, old, new) for every key of two sorted maps in order, with nullptr for the side lacking it
+template<class Map, class F>
+static void merge_join(const Map& a, const Map& b, F f)
+{
+	const typename Map::mapped_type* none = nullptr;
+	auto i = a.begin(), j = b.begin();
+	while (i != a.end() || j != b.end())
+	{
+		if (j == b.end() || (i != a.end() && i->first < j->first))
+		{
+			f(i->first, &i->second, none);
+			++i;
+		}
+		else if (i == a.end() || j->first < i->first)
+		{
+			f(j->first, none, &j->second);
+			++j;
+		}
+		else
+		{
+			f(i->first, &i->second, &j->second);
+			++i;
+			++j;
+		}
+	}
+}
+
+// the residues of a receptor in sequence order: sequence number, residue name and label in a scheme
+static vector<tuple<int, char, string>> labeled_residues(const receptor_numbering& numbering, const database_tables& t, int scheme_id)
+{
+	auto [offset, width, names] = t.schemes[scheme_id];
+	vector<tuple<int, char, string>> residues;
+	for_each_residue(numbering, [&](int seq, int index, char res_name)
+	{
+		residues.emplace_back(seq, res_name, trim(t.string_table[index].substr(offset, width)));
+	});
+	return residues;
+}
+
+size_t write_release_diff(ostream& out, const database_tables& old_tables, const database_tables& new_tables, int scheme_id)
+{
+	size_t changes = 0;
+	auto line = [&](initializer_list<string> fields)
+	{
+		out << join("\t", fields.begin(), fields.end()) << '\n';
+		++changes;
+	};
+
+	if (old_tables.version != new_tables.version)
+		line({ "version", old_tables.version, new_tables.version });
+
+	merge_join(old_tables.uniprot_dict, new_tables.uniprot_dict, [&](const string& uid, auto old_entry, auto new_entry)
+	{
+		if (!old_entry || !new_entry)
+		{
+			auto& [symbol, species, gene_name, long_species] = old_entry ? *old_entry : *new_entry;
+			line({ old_entry ? string("-receptor") : string("+receptor"), uid, symbol + '_' + species, gene_name });
+		}
+		else if (*old_entry != *new_entry)
+		{
+			line({ "~receptor", uid, get<0>(*old_entry) + '_' + get<1>(*old_entry) + ' ' + get<2>(*old_entry), get<0>(*new_entry) + '_' + get<1>(*new_entry) + ' ' + get<2>(*new_entry) });
+		}
+	});
+
+	merge_join(old_tables.pdb_id_dict, new_tables.pdb_id_dict, [&](const string& pdb_id, auto old_uid, auto new_uid)
+	{
+		if (!old_uid)
+			line({ "+pdb", pdb_id, *new_uid });
+		else if (!new_uid)
+			line({ "-pdb", pdb_id, *old_uid });
+		else if (*old_uid != *new_uid)
+			line({ "~pdb", pdb_id, *old_uid, *new_uid });
+	});
+
+	// the residues of a receptor in both releases are joined by sequence number
+	merge_join(old_tables.numbering_data, new_tables.numbering_data, [&](const string& uid, auto old_numbering, auto new_numbering)
+	{
+		if (!old_numbering || !new_numbering || !old_tables.uniprot_dict.count(uid) || !new_tables.uniprot_dict.count(uid))
+			return;
+		auto a = labeled_residues(*old_numbering, old_tables, scheme_id), b = labeled_residues(*new_numbering, new_tables, scheme_id);
+		auto shown = [](const string& label) { return label.empty() ? string("-") : label; };
+		auto i = a.begin(), j = b.begin();
+		while (i != a.end() || j != b.end())
+		{
+			bool in_old = j == b.end() || (i != a.end() && get<0>(*i) <= get<0>(*j));
+			bool in_new = i == a.end() || (j != b.end() && get<0>(*j) <= get<0>(*i));
+			auto& [seq, res_name, label] = in_new ? *j : *i;
+			string old_label = in_old ? get<2>(*i) : "", new_label = in_new ? get<2>(*j) : "";
+			if (in_old && in_new && get<1>(*i) != get<1>(*j))
+				line({ "~residue", uid, to_string(seq), string(1, get<1>(*i)), string(1, get<1>(*j)) });
+			if (old_label != new_label)
+				line({ "~label", uid, res_name + to_string(seq), shown(old_label), shown(new_label) });
+			if (in_old)
+				++i;
+			if (in_new)
+				++j;
+		}
+	});
+	return changes;
+}
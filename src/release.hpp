@@ -0,0 +1,23 @@
+#pragma once
+#include <ostream>
+#include <string>
+#include <vector>
+#include <utility>
+#include <filesystem>
+#include "database.hpp"
+using namespace std;
+using namespace std::filesystem;
+
+// A release is a binary database file named <name>.db in the releases directory, or the built-in tables under the name
+// "builtin". A release can also be named by the GPCRdb version it holds.
+
+//! Returns the name and GPCRdb version of every release, the built-in one with builtin_version first and the rest by name.
+vector<pair<string, string>> find_releases(const path& dir, const string& builtin_version);
+
+//! Loads the tables of a release; "builtin" gives a copy of the currently loaded tables, so it must come before any other
+//! database is loaded. Throws runtime_error if there is no such release or its file is invalid.
+database_tables load_release(const path& dir, const string& name);
+
+//! Writes the differences from the old tables to the new ones as tab-separated lines, merge-joining their sorted receptor,
+//! pdb id and residue tables in linear time; labels are compared in one scheme. Returns the number of differences.
+size_t write_release_diff(ostream& out, const database_tables& old_tables, const database_tables& new_tables, int scheme_id);
@@ -0,0 +1,347 @@
+#ifndef _WIN32
+#include <termios.h>
+#include <unistd.h>
+#endif
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include "repl.hpp"
+#include "string.hpp"
+using namespace std;
+
+enum class keys
+{
+	none = 1000,
+	up,
+	down,
+	left,
+	right,
+	home,
+	end,
+	del,
+};
+
+static const size_t max_history = 1000;
+
+static string history_path()
+{
+#ifdef _WIN32
+	auto home = getenv("USERPROFILE");
+#else
+	auto home = getenv("HOME");
+#endif
+	return home ? string(home) + "/.gpcrn_history" : string();
+}
+
+#ifdef _WIN32
+
+// Raw console input is not implemented for Windows consoles; lines are read as typed.
+static bool read_line(const string& prompt, string& line, vector<string>&, const function<vector<string>(const string&)>&)
+{
+	cout << prompt << flush;
+	return (bool)safe_getline(cin, line);
+}
+
+#else // __APPLE__ || __linux__ || __unix__ || defined(_POSIX_VERSION)
+
+static void write_out(const string& s)
+{
+	for (size_t done = 0; done < s.size();)
+	{
+		auto n = write(STDOUT_FILENO, s.data() + done, s.size() - done);
+		if (n <= 0)
+			return;
+		done += n;
+	}
+}
+
+static int read_key()
+{
+	char c;
+	if (read(STDIN_FILENO, &c, 1) != 1)
+		return -1;
+	if (c != '\x1b')
+		return (unsigned char)c;
+
+	// ESC [ A, ESC [ 3 ~, ESC O H and friends
+	char seq[3];
+	if (read(STDIN_FILENO, &seq[0], 1) != 1 || read(STDIN_FILENO, &seq[1], 1) != 1)
+		return (int)keys::none;
+	if (seq[0] == '[' && isdigit(seq[1]))
+	{
+		if (read(STDIN_FILENO, &seq[2], 1) != 1 || seq[2] != '~')
+			return (int)keys::none;
+		switch (seq[1])
+		{
+		case '1': case '7': return (int)keys::home;
+		case '4': case '8': return (int)keys::end;
+		case '3': return (int)keys::del;
+		}
+		return (int)keys::none;
+	}
+	if (seq[0] == '[' || seq[0] == 'O')
+	{
+		switch (seq[1])
+		{
+		case 'A': return (int)keys::up;
+		case 'B': return (int)keys::down;
+		case 'C': return (int)keys::right;
+		case 'D': return (int)keys::left;
+		case 'H': return (int)keys::home;
+		case 'F': return (int)keys::end;
+		}
+	}
+	return (int)keys::none;
+}
+
+static size_t common_prefix(const vector<string>& candidates)
+{
+	size_t len = candidates[0].size();
+	for (auto& c : candidates)
+	{
+		size_t i = 0;
+		while (i < len && i < c.size() && tolower(c[i]) == tolower(candidates[0][i]))
+			++i;
+		len = i;
+	}
+	return len;
+}
+
+static void refresh(const string& prompt, const string& buf, size_t pos, const string& hint)
+{
+	string out = "\r" + prompt + buf;
+	if (hint.size())
+		out += "\x1b[90m" + hint + "\x1b[0m";
+	out += "\x1b[K\r";
+	if (prompt.size() + pos)
+		out += "\x1b[" + to_string(prompt.size() + pos) + "C";
+	write_out(out);
+}
+
+static bool read_line(const string& prompt, string& line, vector<string>& history, const function<vector<string>(const string&)>& completer)
+{
+	termios cooked;
+	if (tcgetattr(STDIN_FILENO, &cooked) == -1)
+	{
+		cout << prompt << flush;
+		return (bool)safe_getline(cin, line);
+	}
+
+	termios raw = cooked;
+	raw.c_iflag &= ~(BRKINT | ICRNL | INPCK | ISTRIP | IXON);
+	raw.c_lflag &= ~(ECHO | ICANON | IEXTEN | ISIG);
+	raw.c_cc[VMIN] = 1;
+	raw.c_cc[VTIME] = 0;
+	if (tcsetattr(STDIN_FILENO, TCSAFLUSH, &raw) == -1)
+	{
+		cout << prompt << flush;
+		return (bool)safe_getline(cin, line);
+	}
+
+	string buf;
+	size_t pos = 0, hist_pos = history.size();
+	bool done = false, eof = false;
+
+	auto word_start = [&]
+	{
+		size_t start = pos;
+		while (start > 0 && !isspace(buf[start - 1]))
+			--start;
+		return start;
+	};
+
+	// the ghost text suggests the first completion while the cursor sits at the end of a word
+	auto hint = [&]
+	{
+		size_t start = word_start();
+		if (pos != buf.size() || start == pos)
+			return string();
+		auto candidates = completer(buf.substr(start));
+		return candidates.size() ? candidates[0].substr(pos - start) : string();
+	};
+
+	refresh(prompt, buf, pos, hint());
+	while (!done)
+	{
+		int key = read_key();
+		switch (key)
+		{
+		case -1: // input closed
+			eof = true;
+			done = true;
+			break;
+		case '\r':
+		case '\n':
+			done = true;
+			break;
+		case 3: // ctrl-c discards the line
+			write_out("^C\r\n");
+			buf.clear();
+			pos = 0;
+			break;
+		case 4: // ctrl-d ends the session on an empty line, deletes otherwise
+			if (buf.empty())
+			{
+				eof = true;
+				done = true;
+			}
+			else if (pos < buf.size())
+			{
+				buf.erase(pos, 1);
+			}
+			break;
+		case 127:
+		case 8: // backspace
+			if (pos > 0)
+				buf.erase(--pos, 1);
+			break;
+		case (int)keys::del:
+			if (pos < buf.size())
+				buf.erase(pos, 1);
+			break;
+		case 1: // ctrl-a
+		case (int)keys::home:
+			pos = 0;
+			break;
+		case 5: // ctrl-e
+		case (int)keys::end:
+			pos = buf.size();
+			break;
+		case 2: // ctrl-b
+		case (int)keys::left:
+			if (pos > 0)
+				--pos;
+			break;
+		case 6: // ctrl-f accepts the hint at the end of line
+		case (int)keys::right:
+			if (pos < buf.size())
+				++pos;
+			else
+			{
+				buf += hint();
+				pos = buf.size();
+			}
+			break;
+		case 11: // ctrl-k
+			buf.erase(pos);
+			break;
+		case 21: // ctrl-u
+			buf.erase(0, pos);
+			pos = 0;
+			break;
+		case 23: // ctrl-w
+		{
+			size_t start = pos;
+			while (start > 0 && isspace(buf[start - 1]))
+				--start;
+			while (start > 0 && !isspace(buf[start - 1]))
+				--start;
+			buf.erase(start, pos - start);
+			pos = start;
+			break;
+		}
+		case 12: // ctrl-l
+			write_out("\x1b[H\x1b[2J");
+			break;
+		case 16: // ctrl-p
+		case (int)keys::up:
+			if (hist_pos > 0)
+			{
+				buf = history[--hist_pos];
+				pos = buf.size();
+			}
+			break;
+		case 14: // ctrl-n
+		case (int)keys::down:
+			if (hist_pos < history.size())
+			{
+				buf = ++hist_pos < history.size() ? history[hist_pos] : string();
+				pos = buf.size();
+			}
+			break;
+		case '\t':
+		{
+			size_t start = word_start();
+			auto candidates = completer(buf.substr(start, pos - start));
+			if (candidates.empty())
+			{
+				write_out("\a");
+				break;
+			}
+
+			size_t len = common_prefix(candidates);
+			if (len > pos - start)
+			{
+				buf.replace(start, pos - start, candidates[0], 0, len);
+				pos = start + len;
+			}
+			else if (candidates.size() > 1)
+			{
+				// nothing left to extend, list the candidates below the line
+				string list = "\r\n";
+				for (size_t i = 0; i < candidates.size(); i++)
+					list += candidates[i] + (i + 1 == candidates.size() || i % 6 == 5 ? "\r\n" : "\t");
+				write_out(list);
+			}
+			break;
+		}
+		default:
+			if (key >= 32 && key < 127)
+				buf.insert(pos++, 1, (char)key);
+			break;
+		}
+		refresh(prompt, buf, pos, done ? string() : hint());
+	}
+
+	write_out("\r\n");
+	tcsetattr(STDIN_FILENO, TCSAFLUSH, &cooked);
+	line = buf;
+	return !eof || !buf.empty();
+}
+
+#endif
+
+void run_repl(const string& prompt, const function<vector<string>(const string&)>& completer, const function<void(const string&)>& handler)
+{
+	vector<string> history;
+	auto path = history_path();
+	if (path.size())
+	{
+		ifstream in(path);
+		for (string line; safe_getline(in, line);)
+			if (line.size())
+				history.push_back(line);
+		in.close();
+
+		// keep the history file from growing without bound
+		if (history.size() > max_history)
+		{
+			history.erase(history.begin(), history.end() - max_history);
+			ofstream out(path);
+			for (auto& line : history)
+				out << line << endl;
+		}
+	}
+
+	for (string line; read_line(prompt, line, history, completer);)
+	{
+		trim(line);
+		if (line.empty() || line[0] == '#')
+			continue;
+		if (line == "exit" || line == "quit")
+			break;
+
+		if (history.empty() || history.back() != line)
+		{
+			history.push_back(line);
+			if (path.size())
+				ofstream(path, ios::app) << line << endl;
+		}
+		if (history.size() > max_history)
+			history.erase(history.begin(), history.end() - max_history);
+
+		handler(line);
+	}
+}
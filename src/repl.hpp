@@ -0,0 +1,10 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <functional>
+using namespace std;
+
+//! Runs an interactive read-eval-print loop on the terminal with line editing, history and completion.
+//! The completer maps the word under the cursor to its candidates; the handler is called for every entered line.
+//! Falls back to plain line reading when the terminal cannot be switched to raw mode.
+void run_repl(const string& prompt, const function<vector<string>(const string&)>& completer, const function<void(const string&)>& handler);
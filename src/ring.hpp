@@ -0,0 +1,141 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+//! A bounded lock-free queue between exactly one producer thread and one consumer thread.
+//! Each side owns one index and only reads the other's, so a push or a pop is a couple of atomic loads and one store.
+//! A side waiting for the other spins and yields for a while, then sleeps until a push, a pop or a close wakes it.
+template<class T>
+class spsc_ring
+{
+public:
+	//! Creates a ring of at least capacity slots, rounded up to a power of two.
+	explicit spsc_ring(size_t capacity)
+	{
+		size_t size = 1;
+		while (size < capacity)
+			size <<= 1;
+		slots.resize(size);
+		mask = size - 1;
+	}
+
+	//! Moves an item into the ring unless it is full; called by the producer only.
+	bool try_push(T& item)
+	{
+		auto t = tail.load(memory_order_relaxed);
+		if (t - head_seen == slots.size())
+		{
+			head_seen = head.load(memory_order_acquire);
+			if (t - head_seen == slots.size())
+				return false;
+		}
+		slots[t & mask] = move(item);
+		tail.store(t + 1, memory_order_release);
+		wake();
+		return true;
+	}
+
+	//! Moves the oldest item out of the ring unless it is empty; called by the consumer only.
+	bool try_pop(T& item)
+	{
+		auto h = head.load(memory_order_relaxed);
+		if (h == tail_seen)
+		{
+			tail_seen = tail.load(memory_order_acquire);
+			if (h == tail_seen)
+				return false;
+		}
+		item = move(slots[h & mask]);
+		head.store(h + 1, memory_order_release);
+		wake();
+		return true;
+	}
+
+	//! Tells the consumer that no more items will be pushed; called by the producer only.
+	void close()
+	{
+		closed.store(true, memory_order_release);
+		wake();
+	}
+
+	//! Tells the producer that no more items will be popped, which ends its waits; called by the consumer only.
+	void abandon()
+	{
+		abandoned.store(true, memory_order_release);
+		wake();
+	}
+
+	//! Waits until the ring has an item or is closed, or until the deadline; called by the consumer only.
+	void wait_readable(chrono::steady_clock::time_point deadline = chrono::steady_clock::time_point::max())
+	{
+		wait([this] { return head.load(memory_order_relaxed) != tail.load(memory_order_acquire) || closed.load(memory_order_acquire); }, deadline);
+	}
+
+	//! Waits until the ring has a free slot or is abandoned; called by the producer only.
+	void wait_writable()
+	{
+		wait([this] { return tail.load(memory_order_relaxed) - head.load(memory_order_acquire) < slots.size() || abandoned.load(memory_order_acquire); },
+			chrono::steady_clock::time_point::max());
+	}
+
+	//! Returns whether the producer has closed the ring and the consumer has popped everything; called by the consumer only.
+	bool drained() const
+	{
+		return closed.load(memory_order_acquire) && head.load(memory_order_relaxed) == tail.load(memory_order_acquire);
+	}
+
+private:
+	template<class Ready>
+	void wait(Ready ready, chrono::steady_clock::time_point deadline)
+	{
+		for (int i = 0; i < 128; i++)
+		{
+			if (ready())
+				return;
+			if (i >= 64)
+				this_thread::yield();
+		}
+
+		// a side announces itself before its last look at the indices and the other side looks for sleepers after
+		// moving them, so one of the two always sees the other
+		sleepers.fetch_add(1);
+		atomic_thread_fence(memory_order_seq_cst);
+		{
+			unique_lock<mutex> lock(parking);
+			if (deadline == chrono::steady_clock::time_point::max())
+				wakeup.wait(lock, ready);
+			else
+				wakeup.wait_until(lock, deadline, ready);
+		}
+		sleepers.fetch_sub(1);
+	}
+
+	void wake()
+	{
+		atomic_thread_fence(memory_order_seq_cst);
+		if (sleepers.load(memory_order_relaxed))
+		{
+			lock_guard<mutex> lock(parking);
+			wakeup.notify_all();
+		}
+	}
+
+	vector<T> slots;
+	size_t mask;
+
+	// the indices only grow; each lives on its own cache line next to the copy of the other index its owner last saw
+	alignas(64) atomic<size_t> head{ 0 };
+	size_t tail_seen = 0;
+	alignas(64) atomic<size_t> tail{ 0 };
+	size_t head_seen = 0;
+	alignas(64) atomic<bool> closed{ false };
+	atomic<bool> abandoned{ false };
+	atomic<int> sleepers{ 0 };
+	mutex parking;
+	condition_variable wakeup;
+};
@@ -0,0 +1,182 @@
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+#include "database.hpp"
+#include "scan.hpp"
+using namespace std;
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define GPCRN_X86_64
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define GPCRN_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define GPCRN_TARGET_AVX2
+#endif
+
+// A scheme column copied out of string_table: every label lowercased and padded with spaces into a fixed-size slot,
+// so a label query becomes one comparison per slot regardless of the scheme's offset in the rows.
+struct label_column
+{
+	size_t stride = 0;
+	vector<char> slots; // rows * stride bytes followed by a 32-byte tail any kernel may over-read
+};
+
+static size_t stride_of(size_t width)
+{
+	return width <= 8 ? 8 : width <= 16 ? 16 : width;
+}
+
+static const label_column& get_column(int scheme_id)
+{
+	static table_cache<array<label_column, scheme_count>> columns;
+	return columns.get([]
+	{
+		auto& t = tables();
+		array<label_column, scheme_count> r;
+		for (size_t s = 0; s < t.schemes.size(); s++)
+		{
+			auto [offset, width, names] = t.schemes[s];
+			auto& c = r[s];
+			c.stride = stride_of(width);
+			c.slots.assign(t.string_table.size() * c.stride + 32, ' ');
+			for (size_t row = 0; row < t.string_table.size(); row++)
+			{
+				auto slot = c.slots.data() + row * c.stride;
+				auto label = t.string_table[row].substr(offset, width);
+
+				// trailing blanks of any kind become spaces, the rest is compared as is
+				size_t len = label.size();
+				while (len && isspace(label[len - 1]))
+					--len;
+				for (size_t i = 0; i < len; i++)
+					slot[i] = (char)tolower(label[i]);
+			}
+		}
+		return r;
+	})[scheme_id];
+}
+
+static void scan_scalar(const label_column& c, const char* key, size_t first, vector<char>& matches)
+{
+	for (size_t row = first; row < matches.size(); row++)
+		matches[row] = memcmp(c.slots.data() + row * c.stride, key, c.stride) == 0;
+}
+
+#ifdef GPCRN_X86_64
+
+// a 16-byte lane holds 16 / Stride slots; a slot matches when all of its bytes do
+template<size_t Stride>
+static void scan_sse2(const label_column& c, const char* key, vector<char>& matches)
+{
+	constexpr size_t per_lane = 16 / Stride;
+	constexpr unsigned full = (1u << Stride) - 1;
+	auto k = _mm_loadu_si128((const __m128i*)key);
+	size_t row = 0;
+	for (; row + per_lane <= matches.size(); row += per_lane)
+	{
+		auto m = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(c.slots.data() + row * Stride)), k));
+		for (size_t j = 0; j < per_lane; j++)
+			matches[row + j] = (m >> (j * Stride) & full) == full;
+	}
+	scan_scalar(c, key, row, matches);
+}
+
+template<size_t Stride>
+GPCRN_TARGET_AVX2 static void scan_avx2(const label_column& c, const char* key, vector<char>& matches)
+{
+	constexpr size_t per_lane = 32 / Stride;
+	constexpr unsigned full = (1u << Stride) - 1;
+	auto k = _mm256_loadu_si256((const __m256i*)key);
+	size_t row = 0;
+	for (; row + per_lane <= matches.size(); row += per_lane)
+	{
+		auto m = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(c.slots.data() + row * Stride)), k));
+		for (size_t j = 0; j < per_lane; j++)
+			matches[row + j] = (m >> (j * Stride) & full) == full;
+	}
+	scan_scalar(c, key, row, matches);
+}
+
+static bool has_avx2()
+{
+#ifdef _MSC_VER
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7)
+		return false;
+
+	// the OS must also preserve the upper halves of the ymm registers
+	__cpuid(info, 1);
+	if (!(info[2] & (1 << 27)) || (_xgetbv(0) & 6) != 6)
+		return false;
+
+	__cpuidex(info, 7, 0);
+	return info[1] & (1 << 5);
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif
+
+enum class kernel
+{
+	scalar,
+	sse2,
+	avx2,
+};
+
+static kernel get_kernel()
+{
+#ifdef GPCRN_X86_64
+	static kernel k = has_avx2() ? kernel::avx2 : kernel::sse2;
+	return k;
+#else
+	return kernel::scalar;
+#endif
+}
+
+const char* scan_kernel()
+{
+	switch (get_kernel())
+	{
+	case kernel::avx2:
+		return "avx2";
+	case kernel::sse2:
+		return "sse2";
+	default:
+		return "scalar";
+	}
+}
+
+void scan_label(int scheme_id, const string& label, vector<char>& matches)
+{
+	auto& t = tables();
+	auto& c = get_column(scheme_id);
+	matches.assign(t.string_table.size(), 0);
+	if (label.size() > c.stride)
+		return;
+
+	// the lowercased label padded like a slot and repeated across a 32-byte register
+	string key(max<size_t>(32, c.stride), ' ');
+	for (size_t i = 0; i < key.size(); i += c.stride)
+		for (size_t j = 0; j < label.size() && i + j < key.size(); j++)
+			key[i + j] = (char)tolower(label[j]);
+
+#ifdef GPCRN_X86_64
+	auto k = get_kernel();
+	if (c.stride == 8)
+		return k == kernel::avx2 ? scan_avx2<8>(c, key.data(), matches) : scan_sse2<8>(c, key.data(), matches);
+	if (c.stride == 16)
+		return k == kernel::avx2 ? scan_avx2<16>(c, key.data(), matches) : scan_sse2<16>(c, key.data(), matches);
+#endif
+	scan_scalar(c, key.data(), 0, matches);
+}
@@ -0,0 +1,11 @@
+#pragma once
+#include <string>
+#include <vector>
+using namespace std;
+
+//! Marks every string_table row whose label in a scheme equals the given label, ignoring case and trailing blanks as iequals does.
+//! The label must not contain blanks. The scheme column is compared in bulk by SSE2 or AVX2 kernels when the CPU has them.
+void scan_label(int scheme_id, const string& label, vector<char>& matches);
+
+//! Returns the name of the kernel picked at runtime: "avx2", "sse2" or "scalar".
+const char* scan_kernel();
@@ -0,0 +1,367 @@
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include "answer.hpp"
+#include "api.hpp"
+#include "database.hpp"
+#include "numbering.hpp"
+#include "selfcheck.hpp"
+#include "string.hpp"
+using namespace std;
+
+// a residue of the reference numberings
+struct reference_residue
+{
+	int seq;
+	int index;
+	char res_name;
+};
+
+// every numbered residue of every receptor in sequence order, expanded one by one from the runs without going through
+// find_residue(), decode_runs() or for_each_residue(), which the self-check tests
+static map<string, vector<reference_residue>> expand_numberings()
+{
+	auto& t = tables();
+	map<string, vector<reference_residue>> r;
+	for (auto& [uid, numbering] : t.numbering_data)
+	{
+		auto& [low, length, residues, runs] = numbering;
+		auto& expanded = r[uid];
+		for (size_t k = 0; k < runs.size(); k++)
+			for (int i = 0; i < runs[k][1]; i++)
+				expanded.push_back({ low + runs[k][0] + i, runs[k][2] + i, residues[runs[k][0] + i] });
+	}
+	return r;
+}
+
+// the plain lookups the optimized paths must agree with: every residue of every receptor compared one by one;
+// returns 0 with the answer, 2 on an error or -1 for queries beyond its scope
+static int reference_answer(const query_options& opts, const map<string, vector<reference_residue>>& numberings, const string& query, string& answer)
+{
+	auto& t = tables();
+	auto colon = query.find(':');
+	if (colon == string::npos)
+		return 2;
+	string target = query.substr(0, colon), shown = query.substr(colon + 1), numbering = shown;
+	transform(target.begin(), target.end(), target.begin(), ::toupper);
+	transform(numbering.begin(), numbering.end(), numbering.begin(), ::tolower);
+	if (numbering.find('=') != string::npos)
+		return -1;
+
+	vector<string> uids;
+	array<bool, header_fmts.size()> highlights{};
+	if ((target.empty() && numbering.empty() && !opts.filter) || !resolve_target(target, uids, highlights))
+		return 2;
+	if (opts.filter)
+		uids.erase(remove_if(uids.begin(), uids.end(), [&](auto& uid) { return !opts.filter->test(receptor_ordinal(uid)); }), uids.end());
+
+	auto [offset, width, names] = t.schemes[opts.scheme_id];
+	bool by_seq = numbering.size() && all_of(numbering.begin(), numbering.end(), ::isdigit);
+	if (by_seq ? numbering.size() > 9 : numbering.size() > width)
+		return 2;
+	if (numbering.size())
+		highlights[(int)(by_seq ? headers::sequence : headers::numbering)] = true;
+
+	int wanted = by_seq ? stoi(numbering) : 0;
+	ostringstream out;
+	for (auto& uid : uids)
+	{
+		auto it = numberings.find(uid);
+		bool hit = false;
+		if (it != numberings.end())
+		{
+			for (auto& [seq, stridx, res_name] : it->second)
+			{
+				auto label = t.string_table[stridx].substr(offset, width);
+				if (numbering.empty() || (!hit && (by_seq ? seq == wanted : iequals(label, numbering))))
+				{
+					output_line(out, opts.no_cols, opts.last_col, highlights, uid, to_string(seq), label, res_name, fgcolor::none);
+					hit = true;
+				}
+			}
+		}
+		if (!hit && numbering.size() && opts.show_unmatched)
+			output_line(out, opts.no_cols, opts.last_col, highlights, uid, by_seq ? to_string(wanted) : "?", by_seq ? "?" : shown, '?', fgcolor::none);
+	}
+	answer = out.str();
+	return 0;
+}
+
+// sends cout and cerr into strings for as long as it lives
+struct captured_output
+{
+	ostringstream out, err;
+	streambuf* cout_buffer = cout.rdbuf(out.rdbuf());
+	streambuf* cerr_buffer = cerr.rdbuf(err.rdbuf());
+
+	~captured_output()
+	{
+		cout.rdbuf(cout_buffer);
+		cerr.rdbuf(cerr_buffer);
+	}
+};
+
+int self_check(const bitmap* filter, size_t random_count, unsigned seed)
+{
+	auto& t = tables();
+	mt19937 rng(seed);
+	auto pick = [&](size_t n) { return (size_t)uniform_int_distribution<size_t>(0, n - 1)(rng); };
+
+	// the targets of every kind: uniprot ids, pdb ids, gene names, protein symbols and symbol_species
+	vector<vector<string>> kinds(5);
+	auto collect = [](auto& dict, vector<string>& keys)
+	{
+		for (auto& [key, ignore] : dict)
+			if (keys.empty() || keys.back() != key)
+				keys.push_back(key);
+	};
+	collect(t.uniprot_dict, kinds[0]);
+	collect(t.pdb_id_dict, kinds[1]);
+	collect(t.gene_name_dict, kinds[2]);
+	collect(t.symbol_dict, kinds[3]);
+	collect(t.symbol_species_dict, kinds[4]);
+	auto random_target = [&]
+	{
+		auto kind = pick(kinds.size() + 1);
+		return kind < kinds.size() ? kinds[kind][pick(kinds[kind].size())] : string(pick(4) ? "" : "NOTAGPCR");
+	};
+
+	// the receptor a target stands for, to draw its sequence numbers and labels from
+	auto numberings = [&](const string& target, int scheme_id, bool random)
+	{
+		vector<string> uids, r;
+		array<bool, header_fmts.size()> highlights{};
+		resolve_target(target, uids, highlights);
+		auto& ids = receptor_ids();
+		auto it = t.numbering_data.find(uids.size() ? uids[random ? pick(uids.size()) : 0] : ids[pick(ids.size())]);
+		if (it == t.numbering_data.end())
+			it = t.numbering_data.begin();
+		auto& [low, length, residues, runs] = it->second;
+		auto [offset, width, names] = t.schemes[scheme_id];
+		auto label = [&, offset = offset, width = width](int stridx) { return trim(t.string_table[stridx].substr(offset, width)); };
+
+		if (!random)
+		{
+			for (int seq : { low - 1, low, low + length / 2, low + length - 1, low + length })
+				r.push_back(to_string(seq));
+			if (runs.size())
+			{
+				auto& [start, count, first] = runs[runs.size() / 2];
+				r.push_back(label(first));
+				r.push_back(label(first + count - 1));
+			}
+			r.push_back("9.99x99");
+			return r;
+		}
+
+		string numbering;
+		switch (pick(4))
+		{
+		case 0: numbering = to_string(low - 3 + (int)pick(length + 6)); break;
+		case 1:
+			if (runs.size())
+			{
+				auto& [start, count, first] = runs[pick(runs.size())];
+				numbering = label(first + (int)pick(count));
+				break;
+			}
+			[[fallthrough]];
+		case 2: numbering = label(pick(t.string_table.size())); break;
+		default: numbering = pick(2) ? "x" : to_string(pick(100000)); break;
+		}
+		// letter case must not matter
+		for (auto& c : numbering)
+			if (pick(2))
+				c = (char)toupper(c);
+		return vector<string>{ numbering };
+	};
+
+	// column suppression sets, as the -1 to -6 flags
+	vector<string> column_sets{ "", "1", "25", "3456", "12345" };
+	size_t settings = 0, checked = 0, skipped = 0, mismatches = 0;
+	auto report = [&](const string& engine, const string& query, const string& setting, const string& expected, const string& actual)
+	{
+		if (++mismatches > 20)
+			return;
+		auto e = split(expected, '\n', false), a = split(actual, '\n', false);
+		size_t line = 0;
+		while (line < e.size() && line < a.size() && e[line] == a[line])
+			line++;
+		cerr << "ERROR: " << engine << " differs from the reference for '" << query << "' with" << setting << " on line " << line + 1
+			<< ": expected '" << (line < e.size() ? e[line] : "") << "' but got '" << (line < a.size() ? a[line] : "") << "'" << endl;
+	};
+
+	// the run-length numberings against their plain expansion: every sequence number in and around each receptor
+	// through find_residue(), and its string indices through decode_runs() and back through encode_runs()
+	auto reference = expand_numberings();
+	for (auto& [uid, numbering] : t.numbering_data)
+	{
+		auto& [low, length, residues, runs] = numbering;
+		vector<short> indices(length, -1);
+		for (auto& [seq, stridx, res_name] : reference[uid])
+			indices[seq - low] = (short)stridx;
+
+		for (int seq = low - 1; seq <= low + length; seq++)
+		{
+			int k = seq - low, index = -1;
+			char res_name = '?';
+			bool numbered = k >= 0 && k < length && indices[k] != -1, found = find_residue(numbering, seq, index, res_name);
+			if (numbered != found || (found && (index != indices[k] || res_name != residues[k])))
+				report("find_residue", uid + ':' + to_string(seq), " its runs",
+					numbered ? to_string(indices[k]) + ' ' + residues[k] : "unnumbered", found ? to_string(index) + ' ' + res_name : "unnumbered");
+		}
+
+		// the string index at the first residue where another expansion of the runs differs
+		auto compare = [&, low = low](const string& engine, const vector<short>& actual)
+		{
+			auto [e, a] = mismatch(indices.begin(), indices.end(), actual.begin(), actual.end());
+			auto shown = [](auto it, auto end) { return it == end ? string("nothing") : *it == -1 ? string("unnumbered") : to_string(*it); };
+			if (e != indices.end() || a != actual.end())
+				report(engine, uid + ':' + to_string(low + (e - indices.begin())), " its runs", shown(e, indices.end()), shown(a, actual.end()));
+		};
+		compare("decode_runs", decode_runs(numbering));
+
+		vector<short> recoded(length, -1);
+		for (auto& [offset, count, first] : encode_runs(indices))
+			for (int i = 0; i < count; i++)
+				recoded[offset + i] = (short)(first + i);
+		compare("encode_runs", recoded);
+	}
+
+	cout.flush();
+	for (int scheme_id = 0; scheme_id < (int)t.schemes.size(); scheme_id++)
+	{
+		// every target kind with its numberings in this scheme, full dumps, all receptors at a label and an unknown target
+		vector<string> fixed;
+		for (auto& keys : kinds)
+		{
+			// the first, middle and last of each kind
+			for (auto& key : { keys.front(), keys[keys.size() / 2], keys.back() })
+			{
+				for (auto& numbering : numberings(key, scheme_id, false))
+					fixed.push_back(key + ':' + numbering);
+				fixed.push_back(key + ':');
+			}
+		}
+		fixed.push_back(':' + numberings(kinds[0][0], scheme_id, false)[5]);
+		fixed.push_back(":123");
+		fixed.push_back("NOTAGPCR:123");
+
+		for (int unmatched = 0; unmatched < 2; unmatched++)
+		{
+			for (auto& columns : column_sets)
+			{
+				query_options opts;
+				for (char c : columns)
+					opts.no_cols[c - '1'] = true;
+				for (opts.last_col = 5; opts.last_col >= 0 && opts.no_cols[opts.last_col]; --opts.last_col);
+				opts.no_headers = true;
+				opts.show_unmatched = unmatched;
+				opts.filter = filter;
+				opts.scheme_id = scheme_id;
+				string setting = " -s" + get<2>(t.schemes[scheme_id])[1] + (unmatched ? " -u" : "") + (columns.empty() ? "" : " -" + columns);
+				++settings;
+
+				auto queries = fixed;
+				for (size_t i = 0; i < random_count / (t.schemes.size() * 2 * column_sets.size()) + 1; i++)
+				{
+					auto target = random_target();
+					for (auto& c : target)
+						if (pick(2))
+							c = (char)tolower(c);
+					queries.push_back(target + ':' + numberings(target, scheme_id, true)[0]);
+				}
+
+				// each query is followed by its swapped case, which must not be answered from the cached original
+				for (size_t i = queries.size(); i-- > 0;)
+				{
+					auto swapped = queries[i];
+					for (auto& c : swapped)
+						c = (char)(isupper(c) ? tolower(c) : toupper(c));
+					if (swapped != queries[i])
+						queries.insert(queries.begin() + i + 1, swapped);
+				}
+
+				// one cache for the whole setting, as a resident gpcrn has, so that a query may hit the result of another
+				result_cache cache(1 << 20);
+				string expected_block;
+				vector<string> covered;
+				for (auto& query : queries)
+				{
+					string expected;
+					int retcode = reference_answer(opts, reference, query, expected);
+					if (retcode < 0)
+					{
+						++skipped;
+						continue;
+					}
+					++checked;
+					covered.push_back(query);
+					expected_block += expected;
+
+					// the per-query lookups, cold and then from the cache
+					ostringstream out;
+					int rows = 0, r;
+					{
+						captured_output captured;
+						r = evaluate(opts, query, out, cerr, rows);
+					}
+					if ((r != 0) != (retcode != 0) || (!r && out.str() != expected))
+						report("evaluate", query, setting, retcode ? "(an error)" : expected, r ? "(an error)" : out.str());
+
+					for (auto engine : { "cache", "cache hit" })
+					{
+						int line_no = 0;
+						string actual;
+						{
+							captured_output captured;
+							r = process(opts, &cache, line_no, query);
+							actual = captured.out.str();
+						}
+						if ((r != 0) != (retcode != 0) || (!r && actual != expected))
+							report(engine, query, setting, retcode ? "(an error)" : expected, r ? "(an error)" : actual);
+					}
+
+					// binary records take no constraints and hold up to 24 and 16 characters
+					auto colon = query.find(':');
+					if (colon > 24 || query.size() - colon - 1 > 16)
+						continue;
+					shm_query record{};
+					memcpy(record.target, query.data(), colon);
+					memcpy(record.numbering, query.data() + colon + 1, query.size() - colon - 1);
+					vector<shm_result> results;
+					answer_record(opts, record, results);
+					ostringstream formatted;
+					array<bool, header_fmts.size()> none{};
+					for (auto& row : results)
+					{
+						if (row.receptor < 0)
+							continue;
+						auto label = row.string_index < 0 ? row.seq < 0 ? query.substr(colon + 1) : "?" : t.string_table[row.string_index].substr(get<0>(t.schemes[scheme_id]), get<1>(t.schemes[scheme_id]));
+						output_line(formatted, opts.no_cols, opts.last_col, none, receptor_ids()[row.receptor], row.seq < 0 ? "?" : to_string(row.seq), label, row.residue, fgcolor::none);
+					}
+					if ((results.back().seq != shm_answered) != (retcode != 0) || (!retcode && formatted.str() != expected))
+						report("records", query, setting, retcode ? "(an error)" : expected, results.back().seq != shm_answered ? "(an error)" : formatted.str());
+				}
+
+				// the receptor-grouped block answers all queries at once, in input order
+				int line_no = 0;
+				string actual;
+				{
+					captured_output captured;
+					process_block(opts, nullptr, line_no, covered, true);
+					actual = captured.out.str();
+				}
+				if (actual != expected_block)
+					report("plan", "(" + to_string(covered.size()) + " queries)", setting, expected_block, actual);
+			}
+		}
+	}
+
+	cerr << "INFO: self-check: " << t.numbering_data.size() << " numberings, " << checked << " queries over " << settings << " settings (seed " << seed << "), "
+		<< skipped << " beyond the reference, " << mismatches << " mismatches" << endl;
+	return mismatches ? 2 : 0;
+}
@@ -0,0 +1,10 @@
+#pragma once
+#include <cstddef>
+#include "filter.hpp"
+using namespace std;
+
+//! Runs every target kind, scheme, sequence number and label query, with and without -u and column suppression, plus
+//! random_count random queries drawn from seed, through the optimized lookup paths and diffs their answers byte for
+//! byte against plain lookups, along with the run-length numberings against their expansion. Reports the mismatches
+//! on stderr and returns 2 if there are any.
+int self_check(const bitmap* filter, size_t random_count, unsigned seed);
@@ -0,0 +1,391 @@
+#ifdef __linux__
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "server.hpp"
+#include "string.hpp"
+using namespace std;
+
+// requests beyond these sizes are refused rather than buffered
+static const size_t max_header = 64 << 10;
+static const size_t max_body = 64 << 20;
+
+static int hex_value(char c)
+{
+	return isdigit((unsigned char)c) ? c - '0' : isxdigit((unsigned char)c) ? tolower(c) - 'a' + 10 : -1;
+}
+
+static string url_decode(const string& s)
+{
+	string r;
+	for (size_t i = 0; i < s.size(); i++)
+	{
+		if (s[i] == '+')
+			r += ' ';
+		else if (s[i] == '%' && i + 2 < s.size() && hex_value(s[i + 1]) >= 0 && hex_value(s[i + 2]) >= 0)
+		{
+			r += (char)(hex_value(s[i + 1]) * 16 + hex_value(s[i + 2]));
+			i += 2;
+		}
+		else
+			r += s[i];
+	}
+	return r;
+}
+
+string query_parameter(const string& query, const string& name)
+{
+	for (auto& pair : split(query, string("&")))
+	{
+		auto eq = pair.find('=');
+		if (url_decode(pair.substr(0, eq)) == name)
+			return eq == string::npos ? string() : url_decode(pair.substr(eq + 1));
+	}
+	return string();
+}
+
+static const char* reason(int status)
+{
+	switch (status)
+	{
+	case 200: return "OK";
+	case 400: return "Bad Request";
+	case 404: return "Not Found";
+	case 405: return "Method Not Allowed";
+	case 411: return "Length Required";
+	case 413: return "Payload Too Large";
+	case 431: return "Request Header Fields Too Large";
+	case 500: return "Internal Server Error";
+	case 501: return "Not Implemented";
+	default: return "Unknown";
+	}
+}
+
+static void write_response(string& out, const http_response& res, bool keep_alive)
+{
+	out += "HTTP/1.1 " + to_string(res.status) + ' ' + reason(res.status) + "\r\n";
+	out += "Content-Type: " + res.content_type + "\r\n";
+	out += "Content-Length: " + to_string(res.body.size()) + "\r\n";
+	out += keep_alive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n";
+	out += res.body;
+}
+
+static void write_error(string& out, int status, const string& message)
+{
+	http_response res;
+	res.status = status;
+	res.body = "{\"error\":\"" + json_escape(message) + "\"}";
+	write_response(out, res, false);
+}
+
+// Parses the complete requests at the front of in, answering each into out. Returns false once the connection is to be
+// closed after out is written, and leaves a partial request in the buffer for more input.
+static bool serve_requests(string& in, string& out, const function<void(const http_request&, http_response&)>& handle)
+{
+	for (;;)
+	{
+		auto header_end = in.find("\r\n\r\n");
+		if (header_end == string::npos)
+		{
+			if (in.size() <= max_header)
+				return true;
+			write_error(out, 431, "request header too large");
+			return false;
+		}
+
+		// request line: <method> <target> HTTP/1.x
+		auto line_end = in.find("\r\n");
+		auto parts = split(in.substr(0, line_end), string(" "));
+		if (parts.size() != 3 || !starts_with(parts[2], "HTTP/1."))
+		{
+			write_error(out, 400, "malformed request line");
+			return false;
+		}
+
+		http_request req;
+		req.method = parts[0];
+		auto mark = parts[1].find('?');
+		req.path = parts[1].substr(0, mark);
+		if (mark != string::npos)
+			req.query = parts[1].substr(mark + 1);
+
+		// HTTP/1.1 keeps the connection open unless told otherwise, HTTP/1.0 only when asked
+		bool keep_alive = parts[2] != "HTTP/1.0";
+		size_t length = 0;
+		for (size_t pos = line_end + 2; pos < header_end;)
+		{
+			auto end = in.find("\r\n", pos);
+			auto header = in.substr(pos, end - pos);
+			pos = end + 2;
+
+			auto colon = header.find(':');
+			if (colon == string::npos)
+				continue;
+			auto name = header.substr(0, colon), value = trim(header.substr(colon + 1));
+			transform(name.begin(), name.end(), name.begin(), ::tolower);
+			transform(value.begin(), value.end(), value.begin(), ::tolower);
+			if (name == "content-length")
+			{
+				if (value.empty() || value.size() > 12 || !all_of(value.begin(), value.end(), ::isdigit))
+				{
+					write_error(out, 400, "invalid content length");
+					return false;
+				}
+				length = stoull(value);
+			}
+			else if (name == "transfer-encoding" && value != "identity")
+			{
+				write_error(out, 501, "chunked request bodies are not supported; send a content length");
+				return false;
+			}
+			else if (name == "connection")
+			{
+				keep_alive = value == "keep-alive" || (keep_alive && value != "close");
+			}
+		}
+
+		if (length > max_body)
+		{
+			write_error(out, 413, "request body too large");
+			return false;
+		}
+		if (in.size() < header_end + 4 + length)
+			return true;
+		req.body = in.substr(header_end + 4, length);
+		in.erase(0, header_end + 4 + length);
+
+		http_response res;
+		try
+		{
+			handle(req, res);
+		}
+		catch (exception& ex)
+		{
+			res = http_response();
+			res.status = 500;
+			res.body = "{\"error\":\"" + json_escape(ex.what()) + "\"}";
+		}
+		write_response(out, res, keep_alive);
+		if (!keep_alive)
+			return false;
+	}
+}
+
+#ifdef __linux__
+
+struct connection
+{
+	int fd;
+	string in, out;
+	size_t written = 0;
+	bool closing = false; // close once out is written
+};
+
+static void set_nonblocking(int fd)
+{
+	fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+}
+
+static void run_worker(int ep, int listener, const function<void(const http_request&, http_response&)>& handle)
+{
+	map<int, unique_ptr<connection>> connections;
+	auto close_connection = [&](int fd)
+	{
+		epoll_ctl(ep, EPOLL_CTL_DEL, fd, nullptr);
+		close(fd);
+		connections.erase(fd);
+	};
+
+	// writes what it can; false if the connection is done with
+	auto flush = [&](connection& c)
+	{
+		while (c.written < c.out.size())
+		{
+			auto n = send(c.fd, c.out.data() + c.written, c.out.size() - c.written, MSG_NOSIGNAL);
+			if (n < 0)
+			{
+				if (errno == EINTR)
+					continue;
+				if (errno == EAGAIN || errno == EWOULDBLOCK)
+					break;
+				return false;
+			}
+			c.written += n;
+		}
+		if (c.written == c.out.size())
+		{
+			c.out.clear();
+			c.written = 0;
+			if (c.closing)
+				return false;
+		}
+
+		// wait for the socket to drain before reading more, which bounds the output buffered per connection
+		epoll_event e{};
+		e.events = c.out.empty() ? EPOLLIN | EPOLLRDHUP : EPOLLOUT;
+		e.data.fd = c.fd;
+		epoll_ctl(ep, EPOLL_CTL_MOD, c.fd, &e);
+		return true;
+	};
+
+	vector<epoll_event> events(256);
+	char buffer[1 << 16];
+	for (;;)
+	{
+		int n = epoll_wait(ep, events.data(), (int)events.size(), -1);
+		if (n < 0)
+			continue;
+
+		for (int i = 0; i < n; i++)
+		{
+			int fd = events[i].data.fd;
+			if (fd == listener)
+			{
+				// one connection per wakeup spreads them over the workers; the listener stays readable for the rest
+				int client = accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+				if (client < 0)
+					continue;
+				int one = 1;
+				setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+				epoll_event e{};
+				e.events = EPOLLIN | EPOLLRDHUP;
+				e.data.fd = client;
+				epoll_ctl(ep, EPOLL_CTL_ADD, client, &e);
+				auto c = make_unique<connection>();
+				c->fd = client;
+				connections[client] = move(c);
+				continue;
+			}
+
+			auto it = connections.find(fd);
+			if (it == connections.end())
+				continue;
+			auto& c = *it->second;
+
+			if (events[i].events & EPOLLOUT)
+			{
+				if (!flush(c))
+					close_connection(fd);
+				continue;
+			}
+
+			bool eof = false;
+			for (;;)
+			{
+				auto r = recv(fd, buffer, sizeof(buffer), 0);
+				if (r > 0)
+				{
+					c.in.append(buffer, r);
+					continue;
+				}
+				if (r < 0 && errno == EINTR)
+					continue;
+				eof = r == 0 || (errno != EAGAIN && errno != EWOULDBLOCK);
+				break;
+			}
+
+			if (!c.closing && !serve_requests(c.in, c.out, handle))
+				c.closing = true;
+			if ((eof && c.out.empty()) || !flush(c))
+				close_connection(fd);
+		}
+	}
+}
+
+sockaddr_storage parse_address(const string& host, const string& port, socklen_t& length)
+{
+	if (port.empty() || port.size() > 5 || !all_of(port.begin(), port.end(), ::isdigit) || stoi(port) > 65535)
+		throw runtime_error("invalid port '" + port + "'; use a number up to 65535");
+
+	sockaddr_storage address{};
+	auto name = host.empty() ? "0.0.0.0" : host == "localhost" ? "127.0.0.1" : host;
+	auto v4 = (sockaddr_in*)&address;
+	auto v6 = (sockaddr_in6*)&address;
+	if (inet_pton(AF_INET, name.c_str(), &v4->sin_addr) == 1)
+	{
+		v4->sin_family = AF_INET;
+		v4->sin_port = htons((uint16_t)stoi(port));
+		length = sizeof(sockaddr_in);
+	}
+	else if (inet_pton(AF_INET6, name.c_str(), &v6->sin6_addr) == 1)
+	{
+		v6->sin6_family = AF_INET6;
+		v6->sin6_port = htons((uint16_t)stoi(port));
+		length = sizeof(sockaddr_in6);
+	}
+	else
+	{
+		throw runtime_error("invalid host '" + host + "'; use an IPv4 or IPv6 address or localhost");
+	}
+	return address;
+}
+
+int listen_http(const string& host, const string& port)
+{
+	socklen_t length;
+	auto address = parse_address(host, port, length);
+
+	int listener = socket(address.ss_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (listener >= 0)
+	{
+		int one = 1;
+		setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+		if (bind(listener, (sockaddr*)&address, length) < 0 || listen(listener, SOMAXCONN) < 0)
+		{
+			int error = errno;
+			close(listener);
+			listener = -1;
+			errno = error;
+		}
+	}
+	if (listener < 0)
+		throw runtime_error("cannot listen on '" + host + ":" + port + "'; " + strerror(errno));
+	set_nonblocking(listener);
+	return listener;
+}
+
+void serve_http(int listener, unsigned workers, const function<void(const http_request&, http_response&)>& handle)
+{
+	vector<thread> threads;
+	for (unsigned i = 0; i < max(1u, workers); i++)
+	{
+		int ep = epoll_create1(EPOLL_CLOEXEC);
+		if (ep < 0)
+			throw runtime_error(string("cannot create an epoll instance; ") + strerror(errno));
+
+		// every worker waits on the listener, and EPOLLEXCLUSIVE wakes only one of them per connection
+		epoll_event ev{};
+		ev.events = EPOLLIN | EPOLLEXCLUSIVE;
+		ev.data.fd = listener;
+		epoll_ctl(ep, EPOLL_CTL_ADD, listener, &ev);
+		threads.emplace_back(run_worker, ep, listener, cref(handle));
+	}
+	for (auto& t : threads)
+		t.join();
+}
+
+#else
+
+int listen_http(const string& host, const string& port)
+{
+	throw runtime_error("the HTTP server needs Linux");
+}
+
+void serve_http(int listener, unsigned workers, const function<void(const http_request&, http_response&)>& handle)
+{
+}
+
+#endif
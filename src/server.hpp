@@ -0,0 +1,43 @@
+#pragma once
+#ifdef __linux__
+#include <sys/socket.h>
+#endif
+#include <functional>
+#include <string>
+using namespace std;
+
+//! A parsed HTTP request.
+struct http_request
+{
+	string method;
+	string path;  // the target before any '?'
+	string query; // the raw query string after '?'
+	string body;
+};
+
+//! The response to an HTTP request.
+struct http_response
+{
+	int status = 200;
+	string content_type = "application/json";
+	string body;
+};
+
+#ifdef __linux__
+//! Parses a numeric IPv4 or IPv6 host, or localhost, and a numeric port into a socket address; an empty host means all
+//! interfaces. Names are not resolved, which would need the NSS libraries the static binaries lack.
+//! Throws runtime_error for anything else.
+sockaddr_storage parse_address(const string& host, const string& port, socklen_t& length);
+#endif
+
+//! Binds a listening socket on host:port, which an empty host binds on all interfaces.
+//! Throws runtime_error if the address cannot be bound, or on systems other than Linux.
+int listen_http(const string& host, const string& port);
+
+//! Serves HTTP/1.1 on a socket from listen_http() until the process is stopped, calling handle() for every request.
+//! Each worker thread runs its own epoll loop over the connections it accepted, with keep-alive and pipelining;
+//! handle() is called concurrently by the workers and an exception it throws is answered with status 500.
+void serve_http(int listener, unsigned workers, const function<void(const http_request&, http_response&)>& handle);
+
+//! Returns the decoded value of a parameter in a URL query string, or an empty string if it is missing.
+string query_parameter(const string& query, const string& name);
@@ -0,0 +1,422 @@
+#ifdef __linux__
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include "shm.hpp"
+using namespace std;
+
+static_assert(sizeof(shm_query) == 48 && sizeof(shm_result) == 24, "the records are part of the protocol");
+
+static const char magic[8] = { 'G', 'P', 'C', 'R', 'N', 'S', 'H', 'M' };
+static const uint32_t layout_version = 2;
+static const uint32_t query_capacity = 1 << 12;
+static const uint32_t result_capacity = 1 << 16;
+
+static size_t align_up(size_t n)
+{
+	return (n + 63) & ~(size_t)63;
+}
+
+#ifdef __linux__
+
+// futexes on the shared segment cannot be process-private
+static long futex(atomic<uint32_t>& word, int op, uint32_t value, const timespec* timeout)
+{
+	return syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), op, value, timeout, nullptr, 0);
+}
+
+// sleeps while an index still has the value seen; the waiter count tells the other side to wake it
+static void wait_change(shm_index& index, uint32_t seen, const timespec* timeout = nullptr)
+{
+	index.waiters.fetch_add(1);
+	if (index.value.load() == seen)
+		futex(index.value, FUTEX_WAIT, seen, timeout);
+	index.waiters.fetch_sub(1);
+}
+
+// publishes a new index value and wakes whoever sleeps on it
+static void advance(shm_index& index, uint32_t value)
+{
+	index.value.store(value);
+	if (index.waiters.load())
+		futex(index.value, FUTEX_WAKE, INT_MAX, nullptr);
+}
+
+static void ring(shm_index& doorbell)
+{
+	doorbell.value.fetch_add(1);
+	if (doorbell.waiters.load())
+		futex(doorbell.value, FUTEX_WAKE, INT_MAX, nullptr);
+}
+
+static shm_channel& channel_at(shm_header* header, size_t i)
+{
+	return *reinterpret_cast<shm_channel*>((char*)header + header->channel_offset + i * header->channel_stride);
+}
+
+static shm_query* queries_of(shm_channel& c)
+{
+	return reinterpret_cast<shm_query*>((char*)&c + align_up(sizeof(shm_channel)));
+}
+
+static shm_result* results_of(shm_header* header, shm_channel& c)
+{
+	return reinterpret_cast<shm_result*>(queries_of(c) + header->query_capacity);
+}
+
+// a zombie still answers kill() but will never read its results
+static bool process_alive(pid_t pid)
+{
+	if (kill(pid, 0) < 0 && errno == ESRCH)
+		return false;
+	ifstream stat("/proc/" + to_string(pid) + "/stat");
+	string line;
+	getline(stat, line);
+	auto paren = line.rfind(')');
+	return paren == string::npos || paren + 2 >= line.size() || line[paren + 2] != 'Z';
+}
+
+// the pid of the live server of an existing gpcrn segment, 0 if its server is gone, or -1 if it is no segment of this
+// layout, which includes one whose server is still writing its header
+static pid_t segment_server(const string& path)
+{
+	int fd = shm_open(path.c_str(), O_RDONLY, 0);
+	if (fd < 0)
+		return 0;
+	struct stat st;
+	pid_t pid = -1;
+	if (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(shm_header))
+	{
+		void* base = mmap(nullptr, sizeof(shm_header), PROT_READ, MAP_SHARED, fd, 0);
+		if (base != MAP_FAILED)
+		{
+			auto header = (const shm_header*)base;
+			if (!memcmp(header->magic, magic, sizeof(magic)) && header->version == layout_version)
+				pid = header->server_pid > 0 && process_alive(header->server_pid) ? header->server_pid : 0;
+			munmap(base, sizeof(shm_header));
+		}
+	}
+	close(fd);
+	return pid;
+}
+
+static volatile sig_atomic_t stopping = 0;
+
+static void stop(int)
+{
+	stopping = 1;
+}
+
+void serve_shm(const string& name, unsigned channels, const shm_tables& tables, const function<void(const shm_query&, vector<shm_result>&)>& answer)
+{
+	channels = max(1u, channels);
+	size_t string_width = 0;
+	for (auto& s : tables.strings)
+		string_width = max(string_width, s.size());
+
+	shm_header layout{};
+	memcpy(layout.magic, magic, sizeof(magic));
+	layout.version = layout_version;
+	layout.channel_count = channels;
+	layout.query_capacity = query_capacity;
+	layout.result_capacity = result_capacity;
+	layout.receptor_count = (uint32_t)tables.receptors.size();
+	layout.string_count = (uint32_t)tables.strings.size();
+	layout.string_width = (uint32_t)string_width;
+	layout.label_offset = (uint32_t)tables.label_offset;
+	layout.label_width = (uint32_t)tables.label_width;
+	layout.server_pid = (int32_t)getpid();
+	layout.receptor_offset = align_up(sizeof(shm_header));
+	layout.string_offset = align_up(layout.receptor_offset + 16 * tables.receptors.size());
+	layout.channel_offset = align_up(layout.string_offset + string_width * tables.strings.size());
+	layout.channel_stride = align_up(align_up(sizeof(shm_channel)) + query_capacity * sizeof(shm_query) + result_capacity * sizeof(shm_result));
+	layout.size = layout.channel_offset + channels * layout.channel_stride;
+
+	// a segment left behind by a server that was killed is replaced, one still served is not
+	auto path = "/" + name;
+	int fd = shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+	if (fd < 0 && errno == EEXIST)
+	{
+		auto pid = segment_server(path);
+		if (pid > 0)
+			throw runtime_error("shared memory '" + path + "' is already served by process " + to_string(pid));
+		if (pid < 0)
+			throw runtime_error("shared memory '" + path + "' exists but is not a gpcrn segment of layout version " + to_string(layout_version) + "; remove /dev/shm" + path + " if it is unused");
+		shm_unlink(path.c_str());
+		fd = shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+	}
+	if (fd < 0)
+		throw runtime_error("cannot create shared memory '" + path + "'; " + strerror(errno));
+	if (ftruncate(fd, layout.size) < 0)
+	{
+		close(fd);
+		shm_unlink(path.c_str());
+		throw runtime_error("cannot size shared memory '" + path + "'; " + strerror(errno));
+	}
+	void* base = mmap(nullptr, layout.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (base == MAP_FAILED)
+	{
+		shm_unlink(path.c_str());
+		throw runtime_error("cannot map shared memory '" + path + "'; " + strerror(errno));
+	}
+
+	// the segment starts out zeroed, which is also the initial state of every index; the magic goes in last
+	auto header = (shm_header*)base;
+	memcpy((char*)header + sizeof(header->magic), (char*)&layout + sizeof(layout.magic), offsetof(shm_header, doorbell) - sizeof(layout.magic));
+	for (size_t i = 0; i < tables.receptors.size(); i++)
+		memcpy((char*)base + layout.receptor_offset + 16 * i, tables.receptors[i].data(), min<size_t>(16, tables.receptors[i].size()));
+	for (size_t i = 0; i < tables.strings.size(); i++)
+		memcpy((char*)base + layout.string_offset + string_width * i, tables.strings[i].data(), tables.strings[i].size());
+	atomic_thread_fence(memory_order_release);
+	memcpy(header->magic, magic, sizeof(magic));
+
+	struct sigaction action{};
+	action.sa_handler = stop;
+	sigaction(SIGINT, &action, nullptr);
+	sigaction(SIGTERM, &action, nullptr);
+
+	// per channel, the results of answered queries that did not fit into the result ring yet
+	struct backlog
+	{
+		vector<shm_result> results;
+		size_t sent = 0;
+	};
+	vector<backlog> backlogs(channels);
+
+	auto push = [&](shm_channel& c, backlog& b)
+	{
+		auto ring = results_of(header, c);
+		uint32_t tail = c.result_tail.value.load(memory_order_relaxed), head = c.result_head.value.load(memory_order_acquire);
+		size_t n = min<size_t>(result_capacity - (tail - head), b.results.size() - b.sent);
+		for (size_t i = 0; i < n; i++)
+			ring[(tail + i) & (result_capacity - 1)] = b.results[b.sent + i];
+		if (n)
+			advance(c.result_tail, tail + (uint32_t)n);
+		b.sent += n;
+		return n > 0;
+	};
+
+	// a released channel, or one whose client died, is emptied before it can be claimed again
+	auto reclaim = [&](shm_channel& c, backlog& b)
+	{
+		auto owner = c.owner.load();
+		if (owner == 0 || (owner > 0 && process_alive(owner)))
+			return;
+		b.results.clear();
+		b.sent = 0;
+		c.query_head.value.store(c.query_tail.value.load());
+		c.result_head.value.store(c.result_tail.value.load());
+		c.owner.store(0);
+	};
+
+	unsigned idle = 0;
+	auto last_reclaim = chrono::steady_clock::now();
+	while (!stopping)
+	{
+		// a client ringing after this point cuts the sleep below short
+		uint32_t bell = header->doorbell.value.load();
+		bool busy = false;
+		for (unsigned i = 0; i < channels; i++)
+		{
+			auto& c = channel_at(header, i);
+			auto& b = backlogs[i];
+			if (c.owner.load(memory_order_relaxed) < 0)
+				reclaim(c, b);
+			if (b.sent < b.results.size())
+			{
+				busy |= push(c, b);
+				if (b.sent < b.results.size())
+					continue;
+			}
+			b.results.clear();
+			b.sent = 0;
+
+			// answer queued queries until a ring of results is ready, then release their slots
+			auto queries = queries_of(c);
+			uint32_t head = c.query_head.value.load(memory_order_relaxed), tail = c.query_tail.value.load(memory_order_acquire), n = 0;
+			for (; head + n != tail && b.results.size() < result_capacity; n++)
+				answer(queries[(head + n) & (query_capacity - 1)], b.results);
+			if (!n)
+				continue;
+			advance(c.query_head, head + n);
+			push(c, b);
+			busy = true;
+		}
+
+		if (busy)
+		{
+			idle = 0;
+			continue;
+		}
+
+		auto now = chrono::steady_clock::now();
+		if (now - last_reclaim > chrono::seconds(1))
+		{
+			for (unsigned i = 0; i < channels; i++)
+				reclaim(channel_at(header, i), backlogs[i]);
+			last_reclaim = now;
+		}
+
+		// spin and yield briefly for clients streaming queries, then sleep until one rings
+		if (++idle <= 64)
+			continue;
+		if (idle <= 128)
+		{
+			this_thread::yield();
+			continue;
+		}
+		timespec timeout{ 1, 0 };
+		wait_change(header->doorbell, bell, &timeout);
+	}
+
+	munmap(base, layout.size);
+	shm_unlink(path.c_str());
+}
+
+shm_client::shm_client(const string& name)
+{
+	auto path = "/" + name;
+	int fd = shm_open(path.c_str(), O_RDWR, 0);
+	if (fd < 0)
+		throw runtime_error("cannot open shared memory '" + path + "'; " + strerror(errno) + "; is gpcrn --shm running?");
+	struct stat st;
+	if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(shm_header))
+	{
+		close(fd);
+		throw runtime_error("shared memory '" + path + "' is not a gpcrn segment");
+	}
+	size = st.st_size;
+	base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (base == MAP_FAILED)
+		throw runtime_error("cannot map shared memory '" + path + "'; " + strerror(errno));
+
+	header = (shm_header*)base;
+	if (memcmp(header->magic, magic, sizeof(magic)) || header->version != layout_version || header->size != size)
+	{
+		munmap(base, size);
+		throw runtime_error("shared memory '" + path + "' is not a gpcrn segment of layout version " + to_string(layout_version));
+	}
+	atomic_thread_fence(memory_order_acquire);
+
+	for (uint32_t i = 0; i < header->channel_count && !channel; i++)
+	{
+		int32_t free = 0;
+		if (channel_at(header, i).owner.compare_exchange_strong(free, (int32_t)getpid()))
+			channel = &channel_at(header, i);
+	}
+	if (!channel)
+	{
+		auto count = header->channel_count;
+		munmap(base, size);
+		throw runtime_error("all " + to_string(count) + " channels of shared memory '" + path + "' are taken");
+	}
+	queries = queries_of(*channel);
+	results = results_of(header, *channel);
+}
+
+shm_client::~shm_client()
+{
+	// gpcrn empties the rings before handing the channel out again
+	channel->owner.store(-1);
+	ring(header->doorbell);
+	munmap(base, size);
+}
+
+size_t shm_client::submit(const shm_query* records, size_t count)
+{
+	uint32_t tail = channel->query_tail.value.load(memory_order_relaxed), head = channel->query_head.value.load(memory_order_acquire);
+	size_t n = min<size_t>(header->query_capacity - (tail - head), count);
+	for (size_t i = 0; i < n; i++)
+		queries[(tail + i) & (header->query_capacity - 1)] = records[i];
+	if (n)
+	{
+		channel->query_tail.value.store(tail + (uint32_t)n, memory_order_release);
+		ring(header->doorbell);
+	}
+	return n;
+}
+
+size_t shm_client::poll(shm_result* out, size_t max)
+{
+	uint32_t head = channel->result_head.value.load(memory_order_relaxed), tail = channel->result_tail.value.load(memory_order_acquire);
+	size_t n = min<size_t>(tail - head, max);
+	for (size_t i = 0; i < n; i++)
+		out[i] = results[(head + i) & (header->result_capacity - 1)];
+	if (n)
+	{
+		// gpcrn may be waiting for room to write more results
+		channel->result_head.value.store(head + (uint32_t)n, memory_order_release);
+		ring(header->doorbell);
+	}
+	return n;
+}
+
+// a client never waits for long, in case gpcrn is gone
+static const timespec client_timeout{ 1, 0 };
+
+void shm_client::wait_results()
+{
+	auto head = channel->result_head.value.load(memory_order_relaxed);
+	wait_change(channel->result_tail, head, &client_timeout);
+}
+
+void shm_client::wait_space()
+{
+	auto tail = channel->query_tail.value.load(memory_order_relaxed);
+	wait_change(channel->query_head, tail - header->query_capacity, &client_timeout);
+}
+
+string shm_client::receptor(int32_t ordinal) const
+{
+	if (ordinal < 0 || (uint32_t)ordinal >= header->receptor_count)
+		return string();
+	auto p = (const char*)base + header->receptor_offset + 16 * (size_t)ordinal;
+	return string(p, strnlen(p, 16));
+}
+
+string shm_client::label(int32_t string_index) const
+{
+	if (string_index < 0 || (uint32_t)string_index >= header->string_count)
+		return string();
+	string s((const char*)base + header->string_offset + (size_t)header->string_width * string_index + header->label_offset, header->label_width);
+	while (s.size() && (s.back() == ' ' || s.back() == '\0'))
+		s.pop_back();
+	return s;
+}
+
+#else
+
+void serve_shm(const string& name, unsigned channels, const shm_tables& tables, const function<void(const shm_query&, vector<shm_result>&)>& answer)
+{
+	throw runtime_error("the shared-memory transport needs Linux");
+}
+
+shm_client::shm_client(const string& name)
+{
+	throw runtime_error("the shared-memory transport needs Linux");
+}
+
+shm_client::~shm_client() {}
+size_t shm_client::submit(const shm_query* records, size_t count) { return 0; }
+size_t shm_client::poll(shm_result* out, size_t max) { return 0; }
+void shm_client::wait_results() {}
+void shm_client::wait_space() {}
+string shm_client::receptor(int32_t ordinal) const { return string(); }
+string shm_client::label(int32_t string_index) const { return string(); }
+
+#endif
@@ -0,0 +1,121 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+using namespace std;
+
+// The shared-memory transport of gpcrn --shm for clients on the same host. The segment starts with an shm_header,
+// followed by the receptor ids, the string table and the channels. Every channel is owned by one client at a time and
+// holds two single-producer single-consumer rings of fixed-size records: queries from the client and results back.
+// Ring indices count records forever and wrap by the power-of-two capacity; waiting sides sleep on them with futexes.
+
+//! A query written by a client. Strings are NUL-padded rather than terminated when they fill the field.
+struct shm_query
+{
+	uint64_t tag;        // copied into every result of the query
+	char target[24];     // uniprot id, pdb id, gene name, protein symbol or symbol_species; empty for all receptors
+	char numbering[16];  // residue sequence number, label in the served scheme, or empty for every residue
+};
+
+//! A result row written back by gpcrn. Every answer ends with a status record whose receptor is -1.
+struct shm_result
+{
+	uint64_t tag;
+	int32_t receptor;     // ordinal into the receptor ids, or -1 on the status record
+	int32_t seq;          // residue sequence number, -1 for an unmatched label; on the status record one of shm_status
+	int32_t string_index; // string_table row, -1 if unmatched; on the status record the number of rows
+	char residue;         // one-letter residue name, '?' if unmatched
+	char reserved[3];
+};
+
+//! The outcome of a query in its status record.
+enum shm_status : int32_t
+{
+	shm_answered = 0,
+	shm_unknown_target = 1,
+	shm_invalid_numbering = 2,
+};
+
+//! A ring index on a cache line of its own, with the number of processes sleeping until it changes.
+struct alignas(64) shm_index
+{
+	atomic<uint32_t> value;
+	atomic<uint32_t> waiters;
+};
+
+//! A channel: the owning client's pid, or 0 if free, and the query and result rings whose records follow it.
+struct shm_channel
+{
+	alignas(64) atomic<int32_t> owner;
+	shm_index query_head, query_tail, result_head, result_tail;
+};
+
+//! The start of the segment.
+struct shm_header
+{
+	char magic[8];             // "GPCRNSHM"
+	uint32_t version;          // of this layout, 2
+	uint32_t channel_count;
+	uint32_t query_capacity;   // records per query ring, a power of two
+	uint32_t result_capacity;  // records per result ring, a power of two
+	uint32_t receptor_count;   // 16-byte NUL-padded uniprot ids at receptor_offset, in ordinal order
+	uint32_t string_count;     // string_width-byte rows of the string table at string_offset
+	uint32_t string_width;
+	uint32_t label_offset;     // the labels of the served scheme within a string table row
+	uint32_t label_width;
+	int32_t server_pid;        // the gpcrn serving the segment, which another one only replaces once it is gone
+	uint64_t receptor_offset, string_offset, channel_offset, channel_stride, size;
+	shm_index doorbell;        // bumped by clients after writing queries or reading results; gpcrn sleeps on it
+};
+
+//! The tables describing the receptor ordinals and string indices of the results.
+struct shm_tables
+{
+	vector<string> receptors;
+	vector<string> strings;
+	size_t label_offset = 0, label_width = 0;
+};
+
+//! Creates the segment /name with the given number of channels and answers queries on it until SIGINT or SIGTERM,
+//! then removes it. answer() appends the result rows of a query, ending with its status record.
+//! Throws runtime_error if the segment cannot be created, or on systems other than Linux.
+void serve_shm(const string& name, unsigned channels, const shm_tables& tables, const function<void(const shm_query&, vector<shm_result>&)>& answer);
+
+//! A client of gpcrn --shm owning one channel for as long as it lives.
+class shm_client
+{
+public:
+	//! Attaches to the segment /name and claims a free channel; throws runtime_error if there is none.
+	explicit shm_client(const string& name);
+	~shm_client();
+	shm_client(const shm_client&) = delete;
+	shm_client& operator=(const shm_client&) = delete;
+
+	//! Queues as many of the queries as the query ring has room for and returns their number, without waiting.
+	size_t submit(const shm_query* queries, size_t count);
+
+	//! Moves up to max available results into out and returns their number, without waiting.
+	size_t poll(shm_result* out, size_t max);
+
+	//! Sleeps until results are available, or for a second at most.
+	void wait_results();
+
+	//! Sleeps until the query ring has room, or for a second at most.
+	void wait_space();
+
+	//! The uniprot id of a receptor ordinal.
+	string receptor(int32_t ordinal) const;
+
+	//! The label of a string table row in the served scheme, without trailing blanks.
+	string label(int32_t string_index) const;
+
+private:
+	void* base = nullptr;
+	size_t size = 0;
+	shm_header* header = nullptr;
+	shm_channel* channel = nullptr;
+	shm_query* queries = nullptr;
+	shm_result* results = nullptr;
+};
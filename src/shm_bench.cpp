@@ -0,0 +1,150 @@
+// gpcrn-shm-bench streams queries through the shared memory segment of a running gpcrn --shm and reports the
+// throughput and latency percentiles of the answers, or prints the answers for checking them against the text output.
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <boost/program_options.hpp>
+#include "string.hpp"
+#include "shm.hpp"
+using namespace std;
+using namespace boost::program_options;
+
+int main(int argc, char* argv[])
+{
+	try
+	{
+		string name, file;
+		size_t requests;
+		bool print;
+
+		options_description options("Options");
+		options.add_options()
+			("name,n", value<string>(&name)->value_name("NAME")->default_value("gpcrn"), "the shared memory segment of gpcrn --shm")
+			("file,f", value<string>(&file)->value_name("FILE"), "the queries to send, one <target>:<numbering> per line")
+			("requests,r", value<size_t>(&requests)->value_name("N"), "the number of queries to send in total, cycling through the file; defaults to one pass")
+			("print", bool_switch(&print), "print the rows of every answer as <uniprot> <residue><seq> <label> instead of the statistics")
+			("help", "this help information")
+			;
+
+		variables_map vm;
+		store(parse_command_line(argc, argv, options), vm);
+		notify(vm);
+
+		if (vm.count("help") || !vm.count("file"))
+		{
+			cout << "Usage: " << argv[0] << " --file <query-file> [--name <segment>] [options]" << endl;
+			cout << "Benchmarks the shared memory transport of gpcrn --shm" << endl;
+			cout << options << endl;
+			return vm.count("help") ? 0 : 2;
+		}
+
+		ifstream in(file);
+		if (!in)
+		{
+			cerr << "ERROR: cannot open query file '" << file << "'" << endl;
+			return 2;
+		}
+		vector<shm_query> queries;
+		for (string line; safe_getline(in, line);)
+		{
+			if (trim(line).empty() || line[0] == '#')
+				continue;
+			auto colon = line.find(':');
+			shm_query q{};
+			if (colon == string::npos || colon > sizeof(q.target) || line.size() - colon - 1 > sizeof(q.numbering))
+			{
+				cerr << "ERROR: invalid query '" << line << "'; the correct form is '<target>:<numbering>' within 24 and 16 characters" << endl;
+				return 2;
+			}
+			memcpy(q.target, line.data(), colon);
+			memcpy(q.numbering, line.data() + colon + 1, line.size() - colon - 1);
+			queries.push_back(q);
+		}
+		if (queries.empty())
+		{
+			cerr << "ERROR: no queries in '" << file << "'" << endl;
+			return 2;
+		}
+		if (!vm.count("requests"))
+			requests = queries.size();
+
+		shm_client client(name);
+
+		// queries stream in as fast as the ring takes them; each one's latency runs until its status record
+		vector<chrono::steady_clock::time_point> sent(requests);
+		vector<long long> latencies;
+		latencies.reserve(requests);
+		vector<shm_query> window(1024);
+		vector<shm_result> results(1 << 14);
+		size_t submitted = 0, answered = 0, rows = 0, errors = 0;
+		auto start = chrono::steady_clock::now();
+		while (answered < requests)
+		{
+			size_t pushed = 0;
+			if (submitted < requests)
+			{
+				size_t count = min(window.size(), requests - submitted);
+				for (size_t i = 0; i < count; i++)
+				{
+					window[i] = queries[(submitted + i) % queries.size()];
+					window[i].tag = submitted + i;
+				}
+				pushed = client.submit(window.data(), count);
+				auto now = chrono::steady_clock::now();
+				for (size_t i = 0; i < pushed; i++)
+					sent[submitted + i] = now;
+				submitted += pushed;
+			}
+
+			size_t n = client.poll(results.data(), results.size());
+			if (!n)
+			{
+				// nothing more goes in until results come out
+				if (!pushed)
+					client.wait_results();
+				continue;
+			}
+			auto now = chrono::steady_clock::now();
+			for (size_t i = 0; i < n; i++)
+			{
+				auto& r = results[i];
+				if (r.receptor >= 0)
+				{
+					++rows;
+					if (print)
+						cout << client.receptor(r.receptor) << ' ' << r.residue << (r.seq < 0 ? string("?") : to_string(r.seq)) << ' ' << (r.string_index < 0 ? string("?") : client.label(r.string_index)) << '\n';
+					continue;
+				}
+				if (r.seq != shm_answered)
+				{
+					++errors;
+					if (print)
+						cout << "ERROR: " << (r.seq == shm_unknown_target ? "unknown target" : "invalid numbering") << " in query " << r.tag << '\n';
+				}
+				latencies.push_back(chrono::duration_cast<chrono::nanoseconds>(now - sent[r.tag]).count());
+				++answered;
+			}
+		}
+		double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		if (print)
+			return 0;
+
+		sort(latencies.begin(), latencies.end());
+		auto percentile = [&](double p) { return latencies[min(latencies.size() - 1, (size_t)(p / 100 * latencies.size()))] / 1000.0; };
+		cout << "queries:     " << answered << " with " << rows << " rows in " << to_fixed(seconds, 3) << " s" << endl;
+		cout << "throughput:  " << to_fixed(answered / seconds, 0) << " queries/s, " << to_fixed(rows / seconds, 0) << " rows/s" << endl;
+		cout << "errors:      " << errors << endl;
+		cout << "latency us:  p50 " << to_fixed(percentile(50), 1) << ", p90 " << to_fixed(percentile(90), 1)
+			<< ", p99 " << to_fixed(percentile(99), 1) << ", max " << to_fixed(latencies.back() / 1000.0, 1) << endl;
+		return 0;
+	}
+	catch (exception& ex)
+	{
+		cerr << "ERROR: " << ex.what() << endl;
+		return 2;
+	}
+}
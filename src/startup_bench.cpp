@@ -0,0 +1,183 @@
+// gpcrn-startup-bench spawns gpcrn over and over for representative single invocations and reports the wall time from
+// spawn to exit, the time spent before main, page faults and peak resident memory of each.
+#ifndef _WIN32
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <boost/program_options.hpp>
+#include "string.hpp"
+using namespace std;
+using namespace std::filesystem;
+using namespace boost::program_options;
+
+// the measurements of one run
+struct run_sample
+{
+	double wall_ms = 0;
+	double pre_main_ms = -1; // -1 if gpcrn did not report entering main
+	long minor_faults = 0;
+	long major_faults = 0;
+	long max_rss_kb = 0;
+	int status = 0;
+};
+
+#ifndef _WIN32
+
+extern char** environ;
+
+static run_sample spawn_once(const string& binary, const vector<string>& args)
+{
+	// gpcrn writes the steady clock at the start of main into the pipe named by GPCRN_STARTUP_FD
+	int fds[2];
+	if (pipe(fds) < 0)
+		throw runtime_error("cannot create a pipe");
+	fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+
+	vector<string> env_strings{ "GPCRN_STARTUP_FD=" + to_string(fds[1]) };
+	for (auto e = environ; *e; ++e)
+		if (!starts_with(string(*e), "GPCRN_STARTUP_FD="))
+			env_strings.push_back(*e);
+	vector<char*> env, argv{ (char*)binary.c_str() };
+	for (auto& e : env_strings)
+		env.push_back((char*)e.c_str());
+	env.push_back(nullptr);
+	for (auto& a : args)
+		argv.push_back((char*)a.c_str());
+	argv.push_back(nullptr);
+
+	posix_spawn_file_actions_t actions;
+	posix_spawn_file_actions_init(&actions);
+	posix_spawn_file_actions_addopen(&actions, 0, "/dev/null", O_RDONLY, 0);
+	posix_spawn_file_actions_addopen(&actions, 1, "/dev/null", O_WRONLY, 0);
+	posix_spawn_file_actions_addopen(&actions, 2, "/dev/null", O_WRONLY, 0);
+
+	run_sample sample;
+	pid_t pid;
+	auto start = chrono::steady_clock::now();
+	int r = posix_spawn(&pid, binary.c_str(), &actions, nullptr, argv.data(), env.data());
+	posix_spawn_file_actions_destroy(&actions);
+	close(fds[1]);
+	if (r)
+	{
+		close(fds[0]);
+		throw runtime_error("cannot run '" + binary + "'; " + strerror(r));
+	}
+
+	rusage usage{};
+	int status;
+	wait4(pid, &status, 0, &usage);
+	auto end = chrono::steady_clock::now();
+
+	string reported;
+	char buffer[64];
+	for (ssize_t n; (n = read(fds[0], buffer, sizeof(buffer))) > 0;)
+		reported.append(buffer, n);
+	close(fds[0]);
+
+	sample.wall_ms = chrono::duration<double, milli>(end - start).count();
+	if (reported.size())
+		sample.pre_main_ms = (stoll(reported) - chrono::duration_cast<chrono::nanoseconds>(start.time_since_epoch()).count()) / 1e6;
+	sample.minor_faults = usage.ru_minflt;
+	sample.major_faults = usage.ru_majflt;
+	sample.max_rss_kb = usage.ru_maxrss;
+	sample.status = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+	return sample;
+}
+
+#endif
+
+int main(int argc, char* argv[])
+{
+	try
+	{
+		path binary;
+		vector<string> invocations;
+		size_t runs, warmup;
+
+		options_description options("Options");
+		options.add_options()
+			("binary,b", value<path>(&binary)->value_name("FILE"), "the gpcrn binary to run; defaults to gpcrn next to this program")
+			("invocation,i", value<vector<string>>(&invocations)->value_name("ARGS"), "space-separated arguments of an invocation to measure; may be repeated and defaults to '--version', '-L schemes', 'HTR2A:3.50' and ':3.50'")
+			("runs,n", value<size_t>(&runs)->value_name("N")->default_value(200), "the number of measured runs per invocation")
+			("warmup", value<size_t>(&warmup)->value_name("N")->default_value(5), "the number of unmeasured runs per invocation before them, to warm the page cache")
+			("help", "this help information")
+			;
+
+		variables_map vm;
+		store(parse_command_line(argc, argv, options), vm);
+		notify(vm);
+
+		if (vm.count("help"))
+		{
+			cout << "Usage: " << argv[0] << " [--binary <gpcrn>] [--invocation <args> ...] [options]" << endl;
+			cout << "Benchmarks the startup and single-query latency of gpcrn" << endl;
+			cout << options << endl;
+			return 0;
+		}
+
+#ifdef _WIN32
+		cerr << "ERROR: the startup benchmark needs a POSIX system" << endl;
+		return 2;
+#else
+		if (binary.empty())
+			binary = absolute(path(argv[0])).parent_path() / "gpcrn";
+		if (!exists(binary))
+		{
+			cerr << "ERROR: cannot find gpcrn binary '" << binary.string() << "'; use --binary" << endl;
+			return 2;
+		}
+		if (invocations.empty())
+			invocations = { "--version", "-L schemes", "HTR2A:3.50", ":3.50" };
+		runs = max<size_t>(1, runs);
+
+		cout << left << setw(20) << "Invocation" << right << setw(10) << "p50 ms" << setw(10) << "p99 ms" << setw(14) << "pre-main ms"
+			<< setw(14) << "minor faults" << setw(14) << "major faults" << setw(12) << "max RSS KB" << setw(6) << "rc" << endl;
+		for (auto& invocation : invocations)
+		{
+			auto args = split(invocation, string(" "));
+			for (size_t i = 0; i < warmup; i++)
+				spawn_once(binary.string(), args);
+
+			vector<run_sample> samples;
+			for (size_t i = 0; i < runs; i++)
+				samples.push_back(spawn_once(binary.string(), args));
+
+			// percentiles of the wall time, medians of the rest
+			auto percentile = [&](auto field, double p)
+			{
+				vector<double> values;
+				for (auto& s : samples)
+					values.push_back((double)(s.*field));
+				sort(values.begin(), values.end());
+				return values[min(values.size() - 1, (size_t)(p / 100 * values.size()))];
+			};
+			bool reported = all_of(samples.begin(), samples.end(), [](auto& s) { return s.pre_main_ms >= 0; });
+			cout << left << setw(20) << invocation << right
+				<< setw(10) << to_fixed(percentile(&run_sample::wall_ms, 50), 2)
+				<< setw(10) << to_fixed(percentile(&run_sample::wall_ms, 99), 2)
+				<< setw(14) << (reported ? to_fixed(percentile(&run_sample::pre_main_ms, 50), 2) : "?")
+				<< setw(14) << (long)percentile(&run_sample::minor_faults, 50)
+				<< setw(14) << (long)percentile(&run_sample::major_faults, 50)
+				<< setw(12) << (long)percentile(&run_sample::max_rss_kb, 50)
+				<< setw(6) << samples.back().status << endl;
+		}
+		return 0;
+#endif
+	}
+	catch (exception& ex)
+	{
+		cerr << "ERROR: " << ex.what() << endl;
+		return 2;
+	}
+}
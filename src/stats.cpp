@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <set>
+#include <thread>
+#include "answer.hpp"
+#include "database.hpp"
+#include "numbering.hpp"
+#include "stats.hpp"
+#include "string.hpp"
+using namespace std;
+
+vector<label_stats> compute_stats(const vector<string>& uids, int scheme_id, unsigned threads)
+{
+	auto& t = tables();
+	auto [offset, width, names] = t.schemes[scheme_id];
+
+	// label ids in natural order, and the label id of every string table row
+	map<string, int, decltype(&natural_less)> label_ids(&natural_less);
+	vector<string> row_labels(t.string_table.size());
+	for (size_t r = 0; r < t.string_table.size(); r++)
+	{
+		row_labels[r] = trim(t.string_table[r].substr(offset, width));
+		if (row_labels[r].size())
+			label_ids.emplace(row_labels[r], 0);
+	}
+
+	vector<label_stats> results(label_ids.size());
+	int next_id = 0;
+	for (auto& [label, id] : label_ids)
+	{
+		results[next_id].label = label;
+		id = next_id++;
+	}
+
+	vector<int> row_label_ids(t.string_table.size(), -1);
+	for (size_t r = 0; r < t.string_table.size(); r++)
+		if (row_labels[r].size())
+			row_label_ids[r] = label_ids[row_labels[r]];
+
+	// matrix[label * receptors + receptor] => residue name, 0 if the label is absent in the receptor
+	size_t receptors = uids.size();
+	vector<char> matrix(results.size() * receptors);
+	for (size_t u = 0; u < receptors; u++)
+	{
+		auto it = t.numbering_data.find(uids[u]);
+		if (it == t.numbering_data.end())
+			continue;
+
+		for_each_residue(it->second, [&](int, int index, char res_name)
+		{
+			if (row_label_ids[index] == -1)
+				return;
+
+			// the first residue carrying a label counts, as in label queries
+			auto& cell = matrix[row_label_ids[index] * receptors + u];
+			if (!cell)
+				cell = res_name;
+		});
+	}
+
+	// each label reduces its own contiguous row of the matrix
+	auto reduce = [&](size_t first, size_t last)
+	{
+		for (size_t l = first; l < last; l++)
+		{
+			auto& s = results[l];
+			auto row = matrix.data() + l * receptors;
+			for (size_t u = 0; u < receptors; u++)
+			{
+				int c = toupper(row[u]) - 'A';
+				if (row[u] && c >= 0 && c < 26)
+				{
+					++s.counts[c];
+					++s.covered;
+				}
+			}
+			for (auto n : s.counts)
+				if (n)
+					s.entropy += (double)n / s.covered * log2((double)s.covered / n);
+		}
+	};
+
+	threads = max(1u, min(threads, (unsigned)results.size()));
+	size_t chunk = (results.size() + threads - 1) / threads;
+	vector<thread> workers;
+	for (size_t first = 0; first < results.size(); first += chunk)
+		workers.emplace_back(reduce, first, min(first + chunk, results.size()));
+	for (auto& w : workers)
+		w.join();
+
+	return results;
+}
+
+int output_stats(const vector<string>& queries, bool no_headers, bool fuzzy, const bitmap* filter, int scheme_id)
+{
+	auto& t = tables();
+	// the query targets select receptors, their numberings select labels; all of them by default
+	vector<string> uids;
+	set<string> labels;
+	for (auto& query : queries)
+	{
+		smatch ms;
+		if (!regex_match(query, ms, regex("([^:]*):(.*)")))
+		{
+			cerr << "ERROR: invalid query '" << query << "'; the correct form is '<target>:<numbering>'" << endl;
+			return 2;
+		}
+
+		string target = ms[1].str(), numbering = ms[2].str();
+		transform(target.begin(), target.end(), target.begin(), ::toupper);
+		transform(numbering.begin(), numbering.end(), numbering.begin(), ::tolower);
+
+		array<bool, header_fmts.size()> highlights{};
+		if (!select_receptors(target, ms[1].str(), fuzzy, filter, uids, highlights, cerr))
+			return 2;
+		if (numbering.size())
+			labels.insert(numbering);
+	}
+
+	if (queries.empty())
+	{
+		array<bool, header_fmts.size()> highlights{};
+		select_receptors("", "", fuzzy, filter, uids, highlights, cerr);
+	}
+
+	sort(uids.begin(), uids.end());
+	uids.erase(unique(uids.begin(), uids.end()), uids.end());
+
+	auto [offset, width, names] = t.schemes[scheme_id];
+	int label_width = max((int)width, (int)names[1].size()) + 2;
+
+	if (!no_headers)
+		cout << left << setw(label_width) << names[1] << setw(7) << "Count" << setw(10) << "Coverage" << setw(9) << "Entropy" << "Residues" << endl;
+
+	for (auto& s : compute_stats(uids, scheme_id, thread::hardware_concurrency()))
+	{
+		auto folded = s.label;
+		transform(folded.begin(), folded.end(), folded.begin(), ::tolower);
+		if (!s.covered || (labels.size() && !labels.count(folded)))
+			continue;
+
+		// residues by descending frequency
+		vector<pair<int, char>> residues;
+		for (int i = 0; i < (int)s.counts.size(); i++)
+			if (s.counts[i])
+				residues.emplace_back(-s.counts[i], (char)('A' + i));
+		sort(residues.begin(), residues.end());
+
+		cout << left << setw(label_width) << s.label << setw(7) << s.covered
+			<< setw(10) << (to_fixed(100.0 * s.covered / uids.size(), 1) + '%')
+			<< setw(9) << to_fixed(s.entropy, 2);
+		for (size_t i = 0; i < residues.size(); i++)
+			cout << (i ? " " : "") << residues[i].second << ' ' << to_fixed(-100.0 * residues[i].first / s.covered, 1) << '%';
+		cout << endl;
+	}
+	return 0;
+}
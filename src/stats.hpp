@@ -0,0 +1,24 @@
+#pragma once
+#include <array>
+#include <string>
+#include <vector>
+#include "filter.hpp"
+using namespace std;
+
+//! Residue statistics of one numbering label across a set of receptors.
+struct label_stats
+{
+	string label;
+	int covered = 0;           // receptors having a residue numbered with the label
+	array<int, 26> counts{};   // residue name 'A' + i => number of receptors
+	double entropy = 0;        // Shannon entropy of the residue distribution in bits
+};
+
+//! Aggregates residue frequencies, entropy and coverage per label of a scheme over the given receptors.
+//! Builds a dense label-by-receptor residue matrix in one pass and reduces its rows on the given number of threads.
+//! Labels come out in natural order (1.2 < 1.10 < 2.1).
+vector<label_stats> compute_stats(const vector<string>& uids, int scheme_id, unsigned threads);
+
+//! Writes the statistics of every label over the receptors selected by the query targets, or all of them, keeping the
+//! labels the numberings name, if any, as a table on cout. Returns 2 with an error on stderr for an invalid query.
+int output_stats(const vector<string>& queries, bool no_headers, bool fuzzy, const bitmap* filter, int scheme_id);
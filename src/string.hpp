@@ -1,6 +1,12 @@
+#pragma once
 #include <string>
 #include <istream>
+#include <sstream>
+#include <iomanip>
 #include <utility>
+#include <cctype>
+#include <algorithm>
+#include <vector>
 using namespace std;
 
 // Since C++17, copy elision is mandatory and no rvalue reference type or move is required on returning.
@@ -151,6 +157,88 @@ bool ends_with(const basic_string<CharT, Traits, Allocator>& str, const CharT* v
 	return true;
 }
 
+//! Determines whether two strings are equal ignoring case, where trailing white spaces of the longer one are ignored.
+inline bool iequals(const string& a, const string& b)
+{
+	for (size_t i = 0; i < a.size() || i < b.size(); ++i)
+	{
+		if (i >= a.size())
+		{
+			if (!isspace(b[i])) return false;
+		}
+		else if (i >= b.size())
+		{
+			if (!isspace(a[i])) return false;
+		}
+		else if (tolower(a[i]) != tolower(b[i]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Compares strings with the digit runs in them taken as numbers, as labels are ordered: 3.9 < 3.10 < 12.48.
+inline bool natural_less(const string& a, const string& b)
+{
+	size_t i = 0, j = 0;
+	while (i < a.size() && j < b.size())
+	{
+		if (isdigit((unsigned char)a[i]) && isdigit((unsigned char)b[j]))
+		{
+			size_t ei = i, ej = j;
+			while (ei < a.size() && isdigit((unsigned char)a[ei]))
+				++ei;
+			while (ej < b.size() && isdigit((unsigned char)b[ej]))
+				++ej;
+			auto x = stoll(a.substr(i, min<size_t>(ei - i, 18))), y = stoll(b.substr(j, min<size_t>(ej - j, 18)));
+			if (x != y)
+				return x < y;
+			i = ei;
+			j = ej;
+		}
+		else if (a[i] != b[j])
+		{
+			return a[i] < b[j];
+		}
+		else
+		{
+			++i;
+			++j;
+		}
+	}
+	return a.size() - i < b.size() - j;
+}
+
+//! Formats a floating-point number with a fixed number of decimal places.
+inline string to_fixed(double value, int precision)
+{
+	ostringstream out;
+	out << fixed << setprecision(precision) << value;
+	return out.str();
+}
+
+//! Escapes a string for use inside a JSON string literal.
+inline string json_escape(const string& str)
+{
+	string r;
+	for (unsigned char c : str)
+	{
+		if (c == '"' || c == '\\')
+			r += '\\';
+		if (c >= 0x20)
+		{
+			r += (char)c;
+			continue;
+		}
+		const char* hex = "0123456789abcdef";
+		r += "\\u00";
+		r += hex[c >> 4];
+		r += hex[c & 15];
+	}
+	return r;
+}
+
 //! Reads characters from an input stream until any of the Windows (\r\n), Linux (\n) or macOS (\r) line endings is met.
 // Origin: https://stackoverflow.com/a/6089413
 template<class CharT, class Traits, class Allocator>
@@ -0,0 +1,40 @@
+# Runs the command given after -- and compares what it writes into OUTPUT, or onto stdout if OUTPUT is not set, with the
+# file EXPECTED. Text is compared regardless of line endings, a binary OUTPUT byte for byte.
+#
+#   cmake -DEXPECTED=<file> [-DOUTPUT=<file>] -P compare.cmake -- <command> [<argument> ...]
+
+set(command)
+set(found FALSE)
+math(EXPR last "${CMAKE_ARGC} - 1")
+foreach(i RANGE ${last})
+  if (found)
+    list(APPEND command "${CMAKE_ARGV${i}}")
+  elseif ("${CMAKE_ARGV${i}}" STREQUAL "--")
+    set(found TRUE)
+  endif()
+endforeach()
+if (NOT command OR NOT EXPECTED)
+  message(FATAL_ERROR "usage: cmake -DEXPECTED=<file> [-DOUTPUT=<file>] -P compare.cmake -- <command> [<argument> ...]")
+endif()
+
+if (OUTPUT)
+  file(REMOVE "${OUTPUT}")
+endif()
+execute_process(COMMAND ${command} OUTPUT_VARIABLE actual ERROR_VARIABLE errors RESULT_VARIABLE result)
+if (NOT result EQUAL 0)
+  message(FATAL_ERROR "the command exited with ${result}:\n${errors}")
+endif()
+
+if (OUTPUT)
+  execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files "${OUTPUT}" "${EXPECTED}" RESULT_VARIABLE different)
+  if (different)
+    message(FATAL_ERROR "${OUTPUT} differs from ${EXPECTED}")
+  endif()
+else()
+  file(READ "${EXPECTED}" expected)
+  string(REPLACE "\r\n" "\n" expected "${expected}")
+  string(REPLACE "\r\n" "\n" actual "${actual}")
+  if (NOT actual STREQUAL expected)
+    message(FATAL_ERROR "the output differs from ${EXPECTED}; it is:\n${actual}")
+  endif()
+endif()
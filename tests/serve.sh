@@ -0,0 +1,43 @@
+#!/bin/bash
+# Starts gpcrn --serve and gpcrn --shm on the built-in tables and compares what they answer over the wire with the
+# expected answers: pipelined HTTP/1.1 requests on one keep-alive connection, and the binary records of the queries
+# in queries.txt read back by gpcrn-shm-bench.
+#
+#   serve.sh <gpcrn> <gpcrn-shm-bench> <tests directory>
+gpcrn=$1
+bench=$2
+dir=$3
+port=$((20000 + $$ % 20000))
+name=gpcrn-test-$$
+actual=$(mktemp)
+trap 'kill $(jobs -p) 2>/dev/null; rm -f "$actual"' EXIT
+
+fail()
+{
+	echo "ERROR: $1" >&2
+	diff "$2" "$actual" >&2
+	exit 1
+}
+
+"$gpcrn" --serve 127.0.0.1:$port --workers 2 2>/dev/null &
+for i in $(seq 50); do
+	(: <> /dev/tcp/127.0.0.1/$port) 2>/dev/null && break
+	sleep 0.1
+done
+exec 3<> /dev/tcp/127.0.0.1/$port
+batch=$'HTR2A:6.48\nADRB2:x'
+printf '%s' "GET /query?q=ADRB2%3A3.50 HTTP/1.1"$'\r\n\r\n' \
+	"GET /query?q=FOO:1 HTTP/1.1"$'\r\n\r\n' \
+	"POST /batch HTTP/1.1"$'\r\n'"Content-Length: ${#batch}"$'\r\n\r\n'"$batch" \
+	"GET /nothing HTTP/1.1"$'\r\n\r\n' \
+	"POST /reload HTTP/1.1"$'\r\nContent-Length: 0\r\n\r\n' \
+	"POST /query HTTP/1.1"$'\r\nContent-Length: 0\r\nConnection: close\r\n\r\n' >&3
+tr -d '\r' <&3 > "$actual"
+cmp -s "$dir/expected/http.txt" "$actual" || fail "the HTTP answers differ from expected/http.txt" "$dir/expected/http.txt"
+
+"$gpcrn" --shm $name --shm-channels 2 -u 2>/dev/null &
+for i in $(seq 50); do
+	"$bench" --name $name --file "$dir/queries.txt" --print > "$actual" 2>/dev/null && break
+	sleep 0.1
+done
+cmp -s "$dir/expected/shm.txt" "$actual" || fail "the shared memory answers differ from expected/shm.txt" "$dir/expected/shm.txt"